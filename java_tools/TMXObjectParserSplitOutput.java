@@ -11,8 +11,17 @@ public class TMXObjectParserSplitOutput {
         Map<String, String> properties = new LinkedHashMap<>();
         Map<String, String> propertyTypes = new HashMap<>();
         List<int[]> pathPoints = new ArrayList<>();
+        int width, height;
+        boolean ellipse;       // <ellipse/>: curva fechada
+        boolean pathTarget;    // Algum agente aponta para ele na propriedade path
+        boolean closed;        // <polygon>: último ponto emenda no primeiro
     }
 
+    // Amostragem densa usada antes de reamostrar as curvas por comprimento
+    private static final int CURVE_DENSE = 1024;
+    private static final int CURVE_DENSE_PER_SEGMENT = 64;
+    private static final int CURVE_MAX_SAMPLES = 256;
+
     public static void main(String[] args) throws IOException {
         if (args.length < 3) {
             System.err.println("Uso: java TMXObjectParser <arquivo.tmx> <pasta_base_do_projeto> fase1_obj");
@@ -26,7 +35,7 @@ public class TMXObjectParserSplitOutput {
         List<String> lines = Files.readAllLines(tmxPath);
         List<TMXObject> allObjects = parseObjects(lines);
 
-        String headerContent = generateHeader(allObjects);
+        String headerContent = generateHeader(allObjects, args[2]);
         String sourceContent = generateSource(allObjects, args[2]);
 
         Files.createDirectories(incPath.getParent());
@@ -57,6 +66,8 @@ public class TMXObjectParserSplitOutput {
                 current.properties.put("__tmx_object_id", id);
                 current.x = extractIntAttribute(line, "x");
                 current.y = extractIntAttribute(line, "y");
+                current.width = Math.max(0, extractIntAttribute(line, "width"));
+                current.height = Math.max(0, extractIntAttribute(line, "height"));
 
                 if (line.contains("polygon") || line.contains("polyline") || current.name.toLowerCase().contains("path")) {
                     current.properties.put("__object_x", String.valueOf(current.x));
@@ -71,7 +82,10 @@ public class TMXObjectParserSplitOutput {
 
                 current.properties.put(key, value);
                 if (!type.isEmpty()) current.propertyTypes.put(key, type);
+            } else if (inObjectGroup && line.startsWith("<ellipse")) {
+                current.ellipse = true;
             } else if (inObjectGroup && (line.contains("<polyline") || line.contains("<polygon"))) {
+                current.closed = line.contains("<polygon");
                 String pointsRaw = extractStringAttribute(line, "points");
                 int baseX = Integer.parseInt(current.properties.getOrDefault("__object_x", "0"));
                 int baseY = Integer.parseInt(current.properties.getOrDefault("__object_y", "0"));
@@ -85,9 +99,103 @@ public class TMXObjectParserSplitOutput {
             }
         }
 
+        Set<String> referenced = new HashSet<>();
+        for (TMXObject obj : objects) {
+            String path = obj.properties.get("path");
+            if (path != null) referenced.add(path);
+        }
+        for (TMXObject obj : objects) {
+            obj.pathTarget = referenced.contains(obj.properties.get("__tmx_object_id"));
+        }
+
         return objects;
     }
 
+    // Objetos que descrevem um caminho (não viram entidade). Elipse só é
+    // caminho quando algum agente a usa no path: as outras continuam no grupo
+    private static boolean isPathShape(TMXObject obj) {
+        return !obj.pathPoints.isEmpty() || (obj.ellipse && obj.pathTarget);
+    }
+
+    // Elipse, ou polyline/polygon com a propriedade curve=true: vira tabela PathCurve
+    private static boolean isCurve(TMXObject obj) {
+        return obj.ellipse || "true".equals(obj.properties.get("curve"));
+    }
+
+    private static double[] catmullRom(int[] p0, int[] p1, int[] p2, int[] p3, double t) {
+        double t2 = t * t, t3 = t2 * t;
+        double[] out = new double[2];
+        for (int k = 0; k < 2; k++) {
+            out[k] = 0.5 * (2 * p1[k] + (p2[k] - p0[k]) * t
+                    + (2 * p0[k] - 5 * p1[k] + 4 * p2[k] - p3[k]) * t2
+                    + (3 * p1[k] - p0[k] - 3 * p2[k] + p3[k]) * t3);
+        }
+        return out;
+    }
+
+    // Polilinha densa sobre a curva (elipse ou Catmull-Rom pelos pontos)
+    private static List<double[]> curveDense(TMXObject obj) {
+        List<double[]> pts = new ArrayList<>();
+        if (obj.ellipse) {
+            double rx = obj.width / 2.0, ry = obj.height / 2.0;
+            double cx = obj.x + rx, cy = obj.y + ry;
+            for (int i = 0; i <= CURVE_DENSE; i++) {
+                double t = 2 * Math.PI * i / CURVE_DENSE;
+                pts.add(new double[]{cx + rx * Math.cos(t), cy + ry * Math.sin(t)});
+            }
+            return pts;
+        }
+
+        List<int[]> p = obj.pathPoints;
+        int n = p.size();
+        if (n < 2) throw new IllegalStateException("Curva " + obj.properties.get("__tmx_object_id") + " precisa de 2 pontos");
+        int segs = obj.closed ? n : n - 1;
+        for (int s = 0; s < segs; s++) {
+            int[] p0 = p.get(obj.closed ? (s - 1 + n) % n : Math.max(s - 1, 0));
+            int[] p1 = p.get(s);
+            int[] p2 = p.get((s + 1) % n);
+            int[] p3 = p.get(obj.closed ? (s + 2) % n : Math.min(s + 2, n - 1));
+            for (int i = 0; i < CURVE_DENSE_PER_SEGMENT; i++) {
+                pts.add(catmullRom(p0, p1, p2, p3, (double) i / CURVE_DENSE_PER_SEGMENT));
+            }
+        }
+        int[] last = obj.closed ? p.get(0) : p.get(n - 1);
+        pts.add(new double[]{last[0], last[1]});
+        return pts;
+    }
+
+    /**
+     * Tabela PathCurve: amostras igualmente espaçadas no comprimento, para a
+     * velocidade ficar constante lendo uma amostra por passo de fase.
+     */
+    private static void appendCurveTable(StringBuilder sb, String pathId, TMXObject obj) {
+        List<double[]> dense = curveDense(obj);
+        boolean closed = obj.ellipse || obj.closed;
+
+        double[] acc = new double[dense.size()];
+        for (int i = 1; i < dense.size(); i++) {
+            acc[i] = acc[i - 1] + Math.hypot(dense.get(i)[0] - dense.get(i - 1)[0], dense.get(i)[1] - dense.get(i - 1)[1]);
+        }
+        double total = acc[acc.length - 1];
+        int count = (int) Math.max(8, Math.min(CURVE_MAX_SAMPLES, Math.round(total)));
+
+        sb.append("const Vect2D_u16 curve_" + pathId + "_points[] = {\n");
+        int j = 0;
+        for (int k = 0; k < count; k++) {
+            double d = total * k / (closed ? count : count - 1);
+            while (j < acc.length - 2 && acc[j + 1] < d) j++;
+            double span = acc[j + 1] - acc[j];
+            double t = span > 0 ? (d - acc[j]) / span : 0;
+            double px = dense.get(j)[0] + (dense.get(j + 1)[0] - dense.get(j)[0]) * t;
+            double py = dense.get(j)[1] + (dense.get(j + 1)[1] - dense.get(j)[1]) * t;
+            sb.append("    { " + Math.round(px) + ", " + Math.round(py) + " },\n");
+        }
+        sb.append("};\n\n");
+
+        sb.append(String.format("const PathCurve curve_%s = { .points = curve_%s_points, .count = %d, .length = %d, .closed = %s };\n\n",
+                pathId, pathId, count, Math.round(total), closed ? "TRUE" : "FALSE"));
+    }
+
     private static boolean isPathAgentCompatible(TMXObject obj) {
         return obj.properties.containsKey("path") &&
                obj.properties.containsKey("path_mode") &&
@@ -105,23 +213,102 @@ public class TMXObjectParserSplitOutput {
         }
     }
 
-    private static String generateHeader(List<TMXObject> objects) {
+    // Tabela de segmentos de um caminho para uma velocidade: "path_43_v1_5"
+    private static String segmentTableName(String pathId, String velocidade) {
+        return "path_" + pathId + "_v" + velocidade.replace('.', '_').replace(',', '_');
+    }
+
+    // Tabelas (caminho, velocidade) usadas pelos agentes, na ordem em que aparecem
+    private static Map<String, String[]> segmentTables(Map<String, List<TMXObject>> grouped, Map<String, TMXObject> paths) {
+        Map<String, String[]> tables = new LinkedHashMap<>();
+        for (List<TMXObject> objs : grouped.values()) {
+            for (TMXObject obj : objs) {
+                if (!isPathAgentCompatible(obj)) continue;
+                String pathId = obj.properties.get("path");
+                String velocidade = obj.properties.get("velocidade");
+                if (!paths.containsKey(pathId) || isCurve(paths.get(pathId)) || parseSpeed(velocidade) <= 0) continue;
+                tables.putIfAbsent(segmentTableName(pathId, velocidade), new String[]{pathId, velocidade});
+            }
+        }
+        return tables;
+    }
+
+    private static double parseSpeed(String velocidade) {
+        try {
+            return Double.parseDouble(velocidade.replace(',', '.'));
+        } catch (NumberFormatException e) {
+            return 0;
+        }
+    }
+
+    /**
+     * Segmento i: path[i] -> path[(i + 1) % n]. Passo por frame em 26.6 e
+     * número de frames para a velocidade dada; o follower só soma em runtime.
+     */
+    private static void appendSegmentTable(StringBuilder sb, String name, List<int[]> points, double speed) {
+        sb.append("const PathSegment " + name + "[] = {\n");
+        int n = points.size();
+        for (int i = 0; i < n; i++) {
+            int[] a = points.get(i);
+            int[] b = points.get((i + 1) % n);
+            int dx = b[0] - a[0];
+            int dy = b[1] - a[1];
+            int steps = Math.max(1, (int) Math.ceil(Math.hypot(dx, dy) / speed));
+            if (steps > 0xFFFF) {
+                throw new IllegalStateException("Segmento longo demais em " + name + " (steps e' u16)");
+            }
+            sb.append(String.format("    { .stepX = %d, .stepY = %d, .steps = %d },\n",
+                    Math.round(dx * 64.0 / steps), Math.round(dy * 64.0 / steps), steps));
+        }
+        sb.append("};\n\n");
+    }
+
+    // Prefixo da fase a partir do nome do header: "fase1_obj.h" -> "fase1"
+    private static String levelPrefix(String filename) {
+        String base = Paths.get(filename).getFileName().toString().replace(".h", "");
+        return base.endsWith("_obj") ? base.substring(0, base.length() - 4) : base;
+    }
+
+    private static String spawnKind(String type) {
+        return "SPAWN_KIND_" + type.toUpperCase(Locale.ROOT);
+    }
+
+    // Tabelas ficam ordenadas por x: o spawner faz busca binária na lista de spawn
+    private static void sortGroupsByX(Map<String, List<TMXObject>> grouped) {
+        for (List<TMXObject> objs : grouped.values()) {
+            objs.sort(Comparator.comparingInt(o -> o.x));
+        }
+    }
+
+    private static List<TMXObject> spawnOrder(Map<String, List<TMXObject>> grouped) {
+        List<TMXObject> all = new ArrayList<>();
+        for (List<TMXObject> objs : grouped.values()) all.addAll(objs);
+        all.sort(Comparator.comparingInt(o -> o.x));
+        return all;
+    }
+
+    private static String generateHeader(List<TMXObject> objects, String filename) {
         StringBuilder sb = new StringBuilder();
-        sb.append("#ifndef OBJETOS_H\n#define OBJETOS_H\n\n#include <genesis.h>\n#include \"components/path_agent.h\"\n#include \"components/path_def.h\"\n\n");
+        sb.append("#ifndef OBJETOS_H\n#define OBJETOS_H\n\n#include <genesis.h>\n#include \"components/path_def.h\"\n#include \"core/spawner_def.h\"\n\n");
 
         Map<String, List<TMXObject>> grouped = new LinkedHashMap<>();
         Map<String, TMXObject> paths = new LinkedHashMap<>();
 
         for (TMXObject obj : objects) {
-            if (!obj.pathPoints.isEmpty()) {
+            if (isPathShape(obj)) {
                 String pathId = obj.properties.get("__tmx_object_id");
-                sb.append("extern const Vect2D_u16 path_" + pathId + "[];\n");
+                if (isCurve(obj)) sb.append("extern const PathCurve curve_" + pathId + ";\n");
+                else              sb.append("extern const Vect2D_u16 path_" + pathId + "[];\n");
                 paths.putIfAbsent(pathId, obj);
             } else {
                 grouped.computeIfAbsent(obj.name, k -> new ArrayList<>()).add(obj);
             }
         }
 
+        for (String table : segmentTables(grouped, paths).keySet()) {
+            sb.append("extern const PathSegment " + table + "[];\n");
+        }
+
         for (Map.Entry<String, List<TMXObject>> entry : grouped.entrySet()) {
             String type = entry.getKey();
             TMXObject sample = entry.getValue().get(0);
@@ -138,13 +325,26 @@ public class TMXObjectParserSplitOutput {
                     key.equals("sprite") || key.equals("w") || key.equals("h"))
                     continue;
 
-                sb.append("    " + inferCType(key, sample) + " " + key + ";\n");
+                sb.append("    " + inferCType(key, entry.getValue()) + " " + key + ";\n");
             }
 
             sb.append("} " + type + "_t;\n\n");
             sb.append("extern const " + type + "_t " + type + "s[];\n");
         }
 
+        // IDs de prefab (tipos de spawn), na ordem dos grupos - indexam o registro de prefabs da fase
+        sb.append("\ntypedef enum {\n");
+        for (String type : grouped.keySet()) {
+            sb.append("    " + spawnKind(type) + ",\n");
+        }
+        sb.append("    SPAWN_KIND_COUNT\n} SpawnKind;\n\n");
+
+        String prefix = levelPrefix(filename);
+        int spawnCount = 0;
+        for (List<TMXObject> objs : grouped.values()) spawnCount += objs.size();
+        sb.append("#define " + prefix.toUpperCase(Locale.ROOT) + "_SPAWN_COUNT " + spawnCount + "\n");
+        sb.append("extern const SpawnPoint " + prefix + "_spawns[" + prefix.toUpperCase(Locale.ROOT) + "_SPAWN_COUNT];\n");
+
         sb.append("\n#endif // OBJETOS_H\n");
         return sb.toString();
     }
@@ -157,14 +357,20 @@ public class TMXObjectParserSplitOutput {
         Map<String, TMXObject> paths = new LinkedHashMap<>();
 
         for (TMXObject obj : objects) {
-            if (!obj.pathPoints.isEmpty()) {
+            if (isPathShape(obj)) {
                 paths.putIfAbsent(obj.properties.get("__tmx_object_id"), obj);
             } else {
                 grouped.computeIfAbsent(obj.name, k -> new ArrayList<>()).add(obj);
             }
         }
 
+        sortGroupsByX(grouped);
+
         for (Map.Entry<String, TMXObject> entry : paths.entrySet()) {
+            if (isCurve(entry.getValue())) {
+                appendCurveTable(sb, entry.getKey(), entry.getValue());
+                continue;
+            }
             sb.append("const Vect2D_u16 path_" + entry.getKey() + "[] = {\n");
             for (int[] pt : entry.getValue().pathPoints) {
                 sb.append("    { " + pt[0] + ", " + pt[1] + " },\n");
@@ -172,6 +378,12 @@ public class TMXObjectParserSplitOutput {
             sb.append("};\n\n");
         }
 
+        Map<String, String[]> tables = segmentTables(grouped, paths);
+        for (Map.Entry<String, String[]> entry : tables.entrySet()) {
+            String[] key = entry.getValue();
+            appendSegmentTable(sb, entry.getKey(), paths.get(key[0]).pathPoints, parseSpeed(key[1]));
+        }
+
         for (Map.Entry<String, List<TMXObject>> entry : grouped.entrySet()) {
             String type = entry.getKey();
             List<TMXObject> objs = entry.getValue();
@@ -184,23 +396,30 @@ public class TMXObjectParserSplitOutput {
                 if (isPathAgentCompatible(obj)) {
                     String pathId = obj.properties.get("path");
                     TMXObject pathObj = paths.get(pathId);
-                    int pathLen = (pathObj != null) ? pathObj.pathPoints.size() : 0;
+                    boolean curve = pathObj != null && isCurve(pathObj);
+                    int pathLen = (pathObj != null && !curve) ? pathObj.pathPoints.size() : 0;
+                    String table = segmentTableName(pathId, obj.properties.get("velocidade"));
+                    String segments = tables.containsKey(table) ? table : "NULL";
 
                     values.add(String.format(".agentDef = { " +
                             ".position = { %d, %d }, " +
-                            ".path = path_%s, " +
+                            ".path = %s, " +
                             ".path_len = %d, " +
                             ".delayInicial = %s, " +
                             ".path_mode = %s, " +
                             ".velocidade = FIX16(%s), " +
+                            ".segments = %s, " +
+                            ".curve = %s, " +
                             ".sprite = \"%s\", " +
                             ".w = %s, .h = %s }",
                         obj.x, obj.y,
-                        pathId,
+                        curve ? "NULL" : "path_" + pathId,
                         pathLen,
                         obj.properties.get("delayInicial"),
                         convertPathMode(obj.properties.get("path_mode")),
                         obj.properties.get("velocidade"),
+                        segments,
+                        curve ? "&curve_" + pathId : "NULL",
                         obj.properties.getOrDefault("sprite", ""),
                         obj.properties.getOrDefault("w", "0"),
                         obj.properties.getOrDefault("h", "0")
@@ -221,6 +440,19 @@ public class TMXObjectParserSplitOutput {
             sb.append("};\n\n");
         }
 
+        // Registros prefab + parâmetro ordenados por x (parâmetro = índice na tabela do tipo)
+        String prefix = levelPrefix(filename);
+        sb.append("const SpawnPoint " + prefix + "_spawns[" + prefix.toUpperCase(Locale.ROOT) + "_SPAWN_COUNT] = {\n");
+        for (TMXObject obj : spawnOrder(grouped)) {
+            List<TMXObject> objs = grouped.get(obj.name);
+            if (objs.indexOf(obj) > 255) {
+                throw new IllegalStateException("Mais de 256 objetos do tipo " + obj.name + " (SpawnPoint.index e' u8)");
+            }
+            sb.append(String.format("    { .x = %d, .y = %d, .kind = %s, .index = %d },\n",
+                    obj.x, obj.y, spawnKind(obj.name), objs.indexOf(obj)));
+        }
+        sb.append("};\n\n");
+
         return sb.toString();
     }
 
@@ -242,23 +474,35 @@ public class TMXObjectParserSplitOutput {
         return line.substring(start, end);
     }
 
-    private static String inferCType(String key, TMXObject obj) {
+    // Inteiros viram u8, a não ser que algum objeto do grupo saia de 0..255 (ex: coordenadas)
+    private static String inferCType(String key, List<TMXObject> objs) {
+        TMXObject obj = objs.get(0);
         String type = obj.propertyTypes.getOrDefault(key, "");
 
         if (type.equals("bool")) return "bool";
         if (type.equals("float")) return "fix16";
-        if (type.equals("int")) return "u8";
+        if (type.equals("int")) return intCType(key, objs);
 
         String value = obj.properties.get(key);
         if (value.equals("true") || value.equals("false")) return "bool";
         try {
             Integer.parseInt(value);
-            return "u8";
+            return intCType(key, objs);
         } catch (NumberFormatException e) {
             return "char*";
         }
     }
 
+    private static String intCType(String key, List<TMXObject> objs) {
+        for (TMXObject o : objs) {
+            String value = o.properties.get(key);
+            if (value == null) continue;
+            int v = Integer.parseInt(value);
+            if (v < 0 || v > 255) return "s16";
+        }
+        return "u8";
+    }
+
     private static String formatValue(String key, TMXObject obj) {
         String value = obj.properties.get(key);
         String type = obj.propertyTypes.getOrDefault(key, "");
@@ -0,0 +1,391 @@
+import java.io.*;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.*;
+import java.util.*;
+
+/**
+ * Compila os textos de uma cena num banco comprimido em ROM (core/text_bank.h).
+ *
+ * Entrada (.txt, ISO-8859-1):
+ *   # comentário
+ *   @NPC_TIA_0
+ *   Oi, querido!
+ *   @PLAYER_DEMO
+ *   Primeira linha
+ *   segunda linha        (linhas seguidas viram '\n')
+ *
+ * Marcações viram bytecode (opcodes < 32, ver TEXT_OP_* em core/text_bank.h):
+ *   {speed N}  quadros por caractere     {wait N}  pausa de N quadros
+ *   {pal N}    paleta dos próximos glifos {jump ID} continua no texto ID
+ *   {choice Sim:ID_A|Nao:ID_B}  cada opção começa numa linha; a escolhida salta para o ID
+ *   {{         chave literal
+ *
+ * Saída: <nome>.h com um #define TXT_<ID> por texto e <nome>.c com o fluxo de
+ * bits Huffman, a árvore e os offsets. IDs seguem a ordem do arquivo, então
+ * falas do mesmo NPC ficam em sequência. Também sai a tabela de glifos usados
+ * pela cena (remap ASCII -> tile), para carregar só eles com setFontSubset.
+ */
+public class TextBankCompiler {
+
+    static class TextEntry {
+        String id;
+        StringBuilder text = new StringBuilder();
+        boolean hasLine;
+    }
+
+    static class Node {
+        final int freq;
+        final int order;        // Desempate estável: a saída não muda entre execuções
+        final int symbol;       // -1 em nós internos
+        final Node zero, one;
+        int index;              // Posição do nó interno na tabela
+
+        Node(int freq, int order, int symbol, Node zero, Node one) {
+            this.freq = freq;
+            this.order = order;
+            this.symbol = symbol;
+            this.zero = zero;
+            this.one = one;
+        }
+
+        boolean isLeaf() { return symbol >= 0; }
+    }
+
+    private static final int LEAF = 0x8000;
+
+    // Mesmos valores de core/text_bank.h
+    private static final int OP_SPEED  = 0x01;
+    private static final int OP_WAIT   = 0x02;
+    private static final int OP_PAL    = 0x03;
+    private static final int OP_CHOICE = 0x04;
+    private static final int OP_JUMP   = 0x05;
+    private static final int OP_OPTION = 0x06;
+    private static final int MAX_CHOICES = 4;   // DIALOGUE_MAX_CHOICES
+    private static final int FONT_GLYPHS = 96;  // ASCII 32..127, como o VDP_loadFont
+    private static final int GLYPH_UNUSED = 0xFF;
+
+    public static void main(String[] args) throws IOException {
+        if (args.length < 3) {
+            System.err.println("Uso: java TextBankCompiler <textos.txt> <pasta_base_do_projeto> fase1_text.h");
+            return;
+        }
+
+        Path txtPath = Paths.get(args[0]);
+        Path incPath = Paths.get(args[1], args[2]);
+        Path srcPath = Paths.get(args[1], args[2].replace(".h", ".c"));
+        String bankName = incPath.getFileName().toString().replace(".h", "");
+
+        List<TextEntry> entries = parseTexts(Files.readAllLines(txtPath, StandardCharsets.ISO_8859_1));
+        if (entries.isEmpty()) {
+            System.err.println("Nenhum texto em " + txtPath);
+            return;
+        }
+        boolean[] used = new boolean[FONT_GLYPHS];
+        used[0] = true;     // Espaço: o motor limpa linhas com ele
+        compileMarkup(entries, used);
+        int[] remap = buildRemap(used);
+
+        int[] freq = new int[256];
+        for (TextEntry e : entries) {
+            for (char c : e.text.toString().toCharArray()) freq[c]++;
+            freq[0]++;
+        }
+
+        Node root = buildTree(freq);
+        List<Node> internals = numberNodes(root);
+        String[] codes = new String[256];
+        assignCodes(root, "", codes);
+
+        ByteArrayOutputStream data = new ByteArrayOutputStream();
+        int[] offsets = new int[entries.size()];
+        int rawBytes = 0;
+        for (int i = 0; i < entries.size(); i++) {
+            offsets[i] = data.size();
+            if (offsets[i] > 0xFFFF) throw new IllegalStateException("Banco maior que 64 KB: divida os textos da cena");
+            String s = entries.get(i).text.toString();
+            rawBytes += s.length() + 1;
+            appendBits(data, s, codes);
+        }
+
+        Files.createDirectories(incPath.getParent());
+        Files.createDirectories(srcPath.getParent());
+        Files.write(incPath, generateHeader(entries, bankName, remap).getBytes());
+        Files.write(srcPath, generateSource(entries, bankName, data.toByteArray(), offsets, internals, rawBytes, remap).getBytes());
+
+        System.out.println("Banco " + bankName + ": " + entries.size() + " textos, "
+                + rawBytes + " -> " + data.size() + " bytes.");
+    }
+
+    private static List<TextEntry> parseTexts(List<String> lines) {
+        List<TextEntry> entries = new ArrayList<>();
+        Set<String> ids = new HashSet<>();
+        TextEntry current = null;
+
+        for (String line : lines) {
+            if (line.startsWith("#")) continue;
+
+            if (line.startsWith("@")) {
+                current = new TextEntry();
+                current.id = line.substring(1).trim().toUpperCase().replaceAll("[^A-Z0-9_]", "_");
+                if (!ids.add(current.id)) throw new IllegalArgumentException("ID repetido: " + current.id);
+                entries.add(current);
+                continue;
+            }
+            if (current == null) {
+                if (!line.trim().isEmpty()) throw new IllegalArgumentException("Texto antes do primeiro @ID: " + line);
+                continue;
+            }
+
+            for (char c : line.toCharArray()) {
+                if (c < 32 || c > 126) throw new IllegalArgumentException("Caractere fora da fonte em " + current.id + ": " + (int) c);
+            }
+            if (current.hasLine) current.text.append('\n');
+            current.text.append(line);
+            current.hasLine = true;
+        }
+
+        // Linhas em branco antes do próximo @ID não fazem parte do texto
+        for (TextEntry e : entries) {
+            int end = e.text.length();
+            while (end > 0 && e.text.charAt(end - 1) == '\n') end--;
+            e.text.setLength(end);
+        }
+        return entries;
+    }
+
+    // Segunda passada: com todos os IDs conhecidos, troca as marcações por opcodes
+    private static void compileMarkup(List<TextEntry> entries, boolean[] used) {
+        Map<String, Integer> ids = new HashMap<>();
+        for (int i = 0; i < entries.size(); i++) ids.put(entries.get(i).id, i);
+
+        for (TextEntry e : entries) {
+            String src = e.text.toString();
+            StringBuilder code = new StringBuilder();
+            int i = 0;
+            while (i < src.length()) {
+                char c = src.charAt(i);
+                if (c != '{') {
+                    appendText(code, String.valueOf(c), used);
+                    i++;
+                    continue;
+                }
+                if (i + 1 < src.length() && src.charAt(i + 1) == '{') {
+                    appendText(code, "{", used);
+                    i += 2;
+                    continue;
+                }
+
+                int end = src.indexOf('}', i);
+                if (end < 0 || src.substring(i, end).indexOf('\n') >= 0)
+                    throw new IllegalArgumentException("Marcação sem '}' em " + e.id);
+                String tag = src.substring(i + 1, end).trim();
+                String name = tag.split("\\s+", 2)[0];
+                String arg = tag.substring(name.length()).trim();
+                i = end + 1;
+
+                switch (name) {
+                    case "speed": appendOp(code, OP_SPEED, parseByte(arg, 1, 255, e.id)); break;
+                    case "wait":  appendOp(code, OP_WAIT, parseByte(arg, 1, 255, e.id)); break;
+                    case "pal":   appendOp(code, OP_PAL, parseByte(arg, 0, 3, e.id)); break;
+                    case "jump":
+                        code.append((char) OP_JUMP);
+                        appendId(code, resolveId(ids, arg, e.id));
+                        break;
+                    case "choice": {
+                        String[] options = arg.split("\\|");
+                        if (options.length < 2 || options.length > MAX_CHOICES)
+                            throw new IllegalArgumentException("Escolha com 2 a " + MAX_CHOICES + " opções em " + e.id);
+                        // Cada opção abre uma linha e marca onde começa: o motor destaca
+                        // a opção inteira, mesmo que o rótulo quebre em mais linhas
+                        int[] targets = new int[options.length];
+                        for (int k = 0; k < options.length; k++) {
+                            int sep = options[k].lastIndexOf(':');
+                            if (sep < 0) throw new IllegalArgumentException("Opção sem ':ID' em " + e.id + ": " + options[k]);
+                            appendText(code, "\n", used);
+                            code.append((char) OP_OPTION);
+                            appendText(code, options[k].substring(0, sep).trim(), used);
+                            targets[k] = resolveId(ids, options[k].substring(sep + 1), e.id);
+                        }
+                        code.append((char) OP_CHOICE).append((char) options.length);
+                        for (int t : targets) appendId(code, t);
+                        break;
+                    }
+                    default:
+                        throw new IllegalArgumentException("Marcação desconhecida em " + e.id + ": {" + tag + "}");
+                }
+            }
+            e.text = code;
+        }
+    }
+
+    // Texto impresso: marca os glifos que a cena precisa (argumentos de opcode não contam)
+    private static void appendText(StringBuilder code, String s, boolean[] used) {
+        for (char c : s.toCharArray()) {
+            if (c >= 32) used[c - 32] = true;
+        }
+        code.append(s);
+    }
+
+    // Glifos usados ganham tiles seguidos, na ordem ASCII
+    private static int[] buildRemap(boolean[] used) {
+        int[] remap = new int[FONT_GLYPHS];
+        int next = 0;
+        for (int i = 0; i < FONT_GLYPHS; i++) remap[i] = used[i] ? next++ : GLYPH_UNUSED;
+        return remap;
+    }
+
+    private static int glyphCount(int[] remap) {
+        int n = 0;
+        for (int r : remap) if (r != GLYPH_UNUSED) n++;
+        return n;
+    }
+
+    private static void appendOp(StringBuilder code, int op, int arg) {
+        code.append((char) op).append((char) arg);
+    }
+
+    // IDs vão como dois bytes, alto primeiro
+    private static void appendId(StringBuilder code, int id) {
+        code.append((char) (id >> 8)).append((char) (id & 0xFF));
+    }
+
+    private static int resolveId(Map<String, Integer> ids, String name, String from) {
+        Integer id = ids.get(name.trim().toUpperCase());
+        if (id == null) throw new IllegalArgumentException("ID inexistente em " + from + ": " + name.trim());
+        return id;
+    }
+
+    private static int parseByte(String arg, int min, int max, String from) {
+        int v = Integer.parseInt(arg);
+        if (v < min || v > max) throw new IllegalArgumentException("Valor fora de " + min + ".." + max + " em " + from + ": " + v);
+        return v;
+    }
+
+    private static Node buildTree(int[] freq) {
+        PriorityQueue<Node> queue = new PriorityQueue<>((a, b) ->
+                a.freq != b.freq ? Integer.compare(a.freq, b.freq) : Integer.compare(a.order, b.order));
+        int order = 0;
+        for (int s = 0; s < 256; s++) {
+            if (freq[s] > 0) queue.add(new Node(freq[s], order++, s, null, null));
+        }
+
+        // Só o '\0': a raiz ainda precisa ser um nó interno
+        if (queue.size() == 1) {
+            Node only = queue.poll();
+            return new Node(only.freq, order, -1, only, only);
+        }
+
+        while (queue.size() > 1) {
+            Node a = queue.poll();
+            Node b = queue.poll();
+            queue.add(new Node(a.freq + b.freq, order++, -1, a, b));
+        }
+        return queue.poll();
+    }
+
+    // Nós internos em largura: a raiz fica no índice 0, como o decodificador espera
+    private static List<Node> numberNodes(Node root) {
+        List<Node> internals = new ArrayList<>();
+        Deque<Node> pending = new ArrayDeque<>();
+        pending.add(root);
+        while (!pending.isEmpty()) {
+            Node n = pending.poll();
+            n.index = internals.size();
+            internals.add(n);
+            if (!n.zero.isLeaf()) pending.add(n.zero);
+            if (n.one != n.zero && !n.one.isLeaf()) pending.add(n.one);
+        }
+        if (internals.size() > 0x7FFF) throw new IllegalStateException("Árvore grande demais");
+        return internals;
+    }
+
+    private static void assignCodes(Node n, String prefix, String[] codes) {
+        if (n.isLeaf()) {
+            codes[n.symbol] = prefix;
+            return;
+        }
+        assignCodes(n.zero, prefix + "0", codes);
+        if (n.one != n.zero) assignCodes(n.one, prefix + "1", codes);
+    }
+
+    // Cada texto começa num byte novo (offsets em bytes); bits MSB primeiro
+    private static void appendBits(ByteArrayOutputStream out, String s, String[] codes) {
+        StringBuilder bits = new StringBuilder();
+        for (char c : s.toCharArray()) bits.append(codes[c]);
+        bits.append(codes[0]);
+        while (bits.length() % 8 != 0) bits.append('0');
+
+        for (int i = 0; i < bits.length(); i += 8) {
+            out.write(Integer.parseInt(bits.substring(i, i + 8), 2));
+        }
+    }
+
+    private static int childEntry(Node child) {
+        return child.isLeaf() ? (LEAF | child.symbol) : child.index;
+    }
+
+    private static String generateHeader(List<TextEntry> entries, String bankName, int[] remap) {
+        StringBuilder sb = new StringBuilder();
+        String guard = bankName.toUpperCase() + "_H";
+        sb.append("#ifndef ").append(guard).append("\n");
+        sb.append("#define ").append(guard).append("\n\n");
+        sb.append("#include \"core/text_bank.h\"\n\n");
+        sb.append("// Gerado por java_tools/TextBankCompiler - não editar\n\n");
+
+        for (int i = 0; i < entries.size(); i++) {
+            sb.append(String.format("#define TXT_%-24s %d\n", entries.get(i).id, i));
+        }
+        sb.append(String.format("\n#define %s_COUNT %d\n", bankName.toUpperCase(), entries.size()));
+        sb.append(String.format("#define %s_GLYPHS %d   // Tiles de fonte do setFontSubset\n\n", bankName.toUpperCase(), glyphCount(remap)));
+        sb.append("extern const TextBank ").append(bankName).append(";\n\n");
+        sb.append("#endif // ").append(guard).append("\n");
+        return sb.toString();
+    }
+
+    private static String generateSource(List<TextEntry> entries, String bankName, byte[] data,
+                                         int[] offsets, List<Node> internals, int rawBytes, int[] remap) {
+        StringBuilder sb = new StringBuilder();
+        sb.append("#include \"").append(bankName).append(".h\"\n\n");
+        sb.append(String.format("// %d textos: %d bytes de texto -> %d bytes de dados + %d de árvore\n\n",
+                entries.size(), rawBytes, data.length, internals.size() * 4));
+
+        sb.append("static const u8 ").append(bankName).append("_data[] = {\n");
+        for (int i = 0; i < data.length; i++) {
+            if (i % 12 == 0) sb.append("    ");
+            sb.append(String.format("0x%02X,", data[i] & 0xFF));
+            sb.append(i % 12 == 11 || i == data.length - 1 ? "\n" : " ");
+        }
+        sb.append("};\n\n");
+
+        sb.append("static const u16 ").append(bankName).append("_offsets[] = {\n");
+        for (int i = 0; i < offsets.length; i++) {
+            sb.append(String.format("    %d,   // TXT_%s\n", offsets[i], entries.get(i).id));
+        }
+        sb.append("};\n\n");
+
+        sb.append("static const u16 ").append(bankName).append("_tree[] = {\n");
+        for (Node n : internals) {
+            sb.append(String.format("    0x%04X, 0x%04X,\n", childEntry(n.zero), childEntry(n.one)));
+        }
+        sb.append("};\n\n");
+
+        sb.append("// Glifo (ASCII - 32) -> tile do subconjunto; 0xFF = não usado na cena\n");
+        sb.append("static const u8 ").append(bankName).append("_glyphs[").append(FONT_GLYPHS).append("] = {\n");
+        for (int i = 0; i < FONT_GLYPHS; i++) {
+            if (i % 16 == 0) sb.append("    ");
+            sb.append(String.format("0x%02X,", remap[i]));
+            sb.append(i % 16 == 15 ? "\n" : " ");
+        }
+        sb.append("};\n\n");
+
+        sb.append("const TextBank ").append(bankName).append(" = {\n");
+        sb.append("    ").append(bankName).append("_data,\n");
+        sb.append("    ").append(bankName).append("_offsets,\n");
+        sb.append("    ").append(bankName).append("_tree,\n");
+        sb.append("    ").append(entries.size()).append(",\n");
+        sb.append("    ").append(bankName).append("_glyphs,\n");
+        sb.append("    ").append(glyphCount(remap)).append("\n");
+        sb.append("};\n");
+        return sb.toString();
+    }
+}
@@ -2,5 +2,5 @@ TILESET bga         "E:\GENDK\Tiled\Teste04\warped-Cave-tileset.tsx" BEST ALL
 MAP bga_map         "E:\GENDK\Tiled\Teste04\Teste04.tmx" "bga" BEST 0
 PALETTE bga_pal     "E:\GENDK\Tiled\Teste04\tilesets.png" 
 
-IMAGE custom_font  "gfx/font.png" BEST NONE
+IMAGE custom_font  "gfx/font.png" NONE NONE
 PALETTE box_pal     "gfx\font.png" 
@@ -6,3 +6,6 @@ java -cp ../tools TMXObjectParserSplitOutput ../Tiled/Teste04/Teste04.tmx ../SMD
 
 ECHO Exporting TILED slopes
 java -cp ../tools TmxSlopeExporter ../Tiled/Teste04/Teste04.tmx ../SMDX/src/tiled/fase1_slopes.h
+
+ECHO Compiling dialogue text bank
+java -cp ../tools TextBankCompiler ../SMDX/res/text/fase1.txt ../SMDX/src/text fase1_text.h
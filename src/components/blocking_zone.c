@@ -1,66 +1,151 @@
 #include "blocking_zone.h"
 #include "physics/physic.h"
+#include "core/anim_controller.h"
+#include "core/logger.h"
+#include "physics/physic_def.h"
+#include "tiled/tiled_map.h"
+#include "core/camera.h"
+#include "core/slab_pool.h"
+#include "components/trigger.h"
 
-static BlockingZone blockingList[MAX_BLOCKING_ZONES];
-static u16 blockingCount = 0;
+static BlockingZone zoneStorage[MAX_BLOCKING_ZONES];
+static SlabPool zonePool;
+static BlockingZone* zones[MAX_BLOCKING_ZONES];  // Zonas criadas na fase
+static u16 zoneCount;
+// Backup dos tiles: cada zona pega tilesW * tilesH bytes e só devolve na troca de fase
+static u8 tileBackup[BLOCKING_BACKUP_TILES];
+static u16 backupUsed;
 
+// Outra zona ligada que cobre o tile (NULL = nenhuma)
+static BlockingZone* coveringZone(const BlockingZone* self, s16 x, s16 y) {
+    for (u16 i = 0; i < zoneCount; i++) {
+        BlockingZone* b = zones[i];
+        if (b == self || !b->active) continue;
+        if (x >= b->tileMin.x && x < b->tileMin.x + b->tilesW &&
+            y >= b->tileMin.y && y < b->tileMin.y + b->tilesH)
+            return b;
+    }
+    return NULL;
+}
+
+static inline u8 savedTile(const BlockingZone* b, s16 x, s16 y) {
+    return b->savedTiles[(y - b->tileMin.y) * b->tilesW + (x - b->tileMin.x)];
+}
+
+/**
+ * @brief Escreve TILE_SOLID na área da zona, guardando o valor original
+ *
+ * Num tile já coberto por outra zona ligada o mapa mostra TILE_SOLID; o
+ * original vem do backup dela. Assim todo backup guarda o mapa da fase e
+ * as zonas podem ser desligadas em qualquer ordem.
+ */
+static void stamp(BlockingZone* b) {
+    u8* saved = b->savedTiles;
+    for (u16 ty = 0; ty < b->tilesH; ty++) {
+        for (u16 tx = 0; tx < b->tilesW; tx++) {
+            s16 x = b->tileMin.x + tx;
+            s16 y = b->tileMin.y + ty;
+            const BlockingZone* other = coveringZone(b, x, y);
+            *saved++ = other ? savedTile(other, x, y) : tiledMap_getTile(x, y);
+            tiledMap_setTile(x, y, TILE_SOLID);
+        }
+    }
+}
+
+// Tiles ainda cobertos por outra zona ligada continuam sólidos
+static void unstamp(BlockingZone* b) {
+    const u8* saved = b->savedTiles;
+    for (u16 ty = 0; ty < b->tilesH; ty++) {
+        for (u16 tx = 0; tx < b->tilesW; tx++, saved++) {
+            s16 x = b->tileMin.x + tx;
+            s16 y = b->tileMin.y + ty;
+            if (!coveringZone(b, x, y)) tiledMap_setTile(x, y, *saved);
+        }
+    }
+}
+
+// Não restaura o mapa: chamado na troca de fase, antes de carregar a nova colisão
+// e antes do SPR_init, com os sprites das zonas ainda válidos
 void blocking_clearAll() {
-    blockingCount = 0;
-    for(u16 i = 0; i < MAX_BLOCKING_ZONES; i++) {
-        blockingList[i].active = FALSE;
+    for (u16 i = 0; i < zoneCount; i++) {
+        if (zones[i]->sprite) SPR_releaseSprite(zones[i]->sprite);
     }
+    slab_init(&zonePool, zoneStorage, sizeof(BlockingZone), MAX_BLOCKING_ZONES);
+    zoneCount = 0;
+    backupUsed = 0;
+    // Triggers ainda vivos não podem apontar para zonas recicladas
+    trigger_releaseZones();
 }
 
-BlockingZone* blocking_create(s16 x, s16 y, s16 w, s16 h) {
-    if (blockingCount >= MAX_BLOCKING_ZONES) return NULL;
+BlockingZone* blocking_get(u16 id) {
+    for (u16 i = 0; i < zoneCount; i++)
+        if (zones[i]->id == id) return zones[i];
+    return NULL;
+}
 
-    BlockingZone* b = &blockingList[blockingCount++];
-    b->active = TRUE;
-    b->hitbox = (Box){x, y, w, h};
+BlockingZone* blocking_create(u16 id, s16 x, s16 y, s16 w, s16 h) {
+    // Alinha aos tiles: origem para baixo, tamanho para cima (a colisão é por tile)
+    s16 tx0 = x >> 4;
+    s16 ty0 = y >> 4;
+    u16 tilesW = (w + 15) >> 4;
+    u16 tilesH = (h + 15) >> 4;
+    u16 tiles = tilesW * tilesH;
+
+    if (backupUsed + tiles > BLOCKING_BACKUP_TILES) {
+        debug_log("Blocking: arena de backup cheia (%d + %d de %d tiles)", backupUsed, tiles, BLOCKING_BACKUP_TILES);
+        return NULL;
+    }
+    BlockingZone* b = slab_alloc(&zonePool);
+    if (!b) {
+        debug_log("Blocking: pool cheio (MAX_BLOCKING_ZONES %d)", MAX_BLOCKING_ZONES);
+        return NULL;
+    }
+    b->id = id;
+    b->hitbox = (Box){tx0 << 4, ty0 << 4, tilesW << 4, tilesH << 4};
+    b->tileMin.x = tx0;
+    b->tileMin.y = ty0;
+    b->tilesW = tilesW;
+    b->tilesH = tilesH;
+    b->savedTiles = &tileBackup[backupUsed];
+    backupUsed += tiles;
+    b->sprite = NULL;
     b->visible = TRUE;
+    b->posSynced = FALSE;
+    zones[zoneCount++] = b;
+
+    b->active = TRUE;
+    stamp(b);
     return b;
 }
 
 void blocking_enable(BlockingZone* zone) {
-    if (zone) zone->active = TRUE;
+    if (!zone || zone->active) return;
+    zone->active = TRUE;
+    stamp(zone);
 }
 
 void blocking_disable(BlockingZone* zone) {
-    if (zone) zone->active = FALSE;
+    if (!zone || !zone->active) return;
+    zone->active = FALSE;
+    unstamp(zone);
 }
 
-void physics_checkBlockingZones(RigidBody* body) {
-    for (u16 i = 0; i < blockingCount; i++) {
-        BlockingZone* b = &blockingList[i];
-        if (!b->active)continue;
-
-        AABB globalAABB;
-        rigidbody_getGlobalAABB(body, &globalAABB);
-        AABB blockerAABB = {
-            .min.x = b->hitbox.x,
-            .min.y = b->hitbox.y,
-            .max.x = b->hitbox.x + b->hitbox.w,
-            .max.y = b->hitbox.y + b->hitbox.h
-        };
-        if (aabb_intersect(&blockerAABB, &globalAABB)) {
-            body->delta.x = 0;
-            body->velocity.x = 0;
-            body->velocity.fixX = 0;
-            // Se estiver descendo, empurra para cima da barreira
-            if (body->delta.y > 0) {
-                // Colisão por baixo → empurra para cima
-                body->globalPosition.y = blockerAABB.min.y - (body->aabb.max.y - body->aabb.min.y);
-                body->delta.y = 0;
-                body->velocity.fixY = 0;
-                body->vState = VSTATE_GROUNDED;
-            }
-            else if (body->delta.y < 0) {
-                // Colisão por cima → opcional, impede subir
-                body->globalPosition.y = blockerAABB.max.y;
-                body->delta.y = 0;
-                body->velocity.fixY = 0;
-            }
-        }
+// O sprite segue a zona, não o trigger: a barreira continua visível com o trigger fora da janela
+void blocking_drawAll() {
+    Vect2D_s16 cam = camera_getPosition();
+
+    for (u16 i = 0; i < zoneCount; i++) {
+        BlockingZone* b = zones[i];
+        if (!b->sprite) continue;
+
+        s16 dx = b->hitbox.x - cam.x;
+        s16 dy = b->hitbox.y - cam.y;
+        bool onScreen = b->active &&
+                        dx + b->hitbox.w >= 0 && dx <= SCREEN_WIDTH &&
+                        dy + b->hitbox.h >= 0 && dy <= SCREEN_HEIGHT;
+
+        blocking_setVisible(b, onScreen);
+        if (onScreen) blocking_setScreenPosition(b, dx, dy);
     }
 }
 
@@ -68,6 +153,16 @@ void blocking_setVisible(BlockingZone* zone, bool visible) {
     if(zone->visible != visible) {  
         zone->visible = visible;
         SPR_setVisibility(zone->sprite, visible ? VISIBLE : HIDDEN);
+        animcontroller_markDirty();
     }
 }
 
+void blocking_setScreenPosition(BlockingZone* zone, s16 x, s16 y) {
+    if (zone->posSynced && zone->screenPos.x == x && zone->screenPos.y == y) return;
+    zone->screenPos.x = x;
+    zone->screenPos.y = y;
+    zone->posSynced = TRUE;
+    SPR_setPosition(zone->sprite, x, y);
+    animcontroller_markDirty();
+}
+
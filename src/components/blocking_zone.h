@@ -8,18 +8,41 @@
 #include "core/game_config.h"
 #include "components/trigger_def.h"
 
-typedef struct {
+/**
+ * @brief Barreira ligável/desligável escrita direto no mapa de colisão
+ *
+ * Ativa, a zona carimba TILE_SOLID nos tiles que cobre e guarda os valores
+ * originais em savedTiles para restaurar quando desligada. O backup sai de
+ * uma arena da fase (BLOCKING_BACKUP_TILES) do tamanho exato da zona, então
+ * não há limite de tamanho por zona. A física não
+ * conhece zonas: elas passam pelo resolvedor normal de tiles. Zonas que se
+ * sobrepõem podem ser ligadas e desligadas em qualquer ordem: um tile só
+ * volta ao original quando nenhuma zona ligada o cobre.
+ *
+ * A caixa é alinhada aos tiles na criação (origem arredondada para baixo,
+ * tamanho para cima): x=750,w=16 vira 736..752. O hitbox guardado já é o
+ * alinhado, e o sprite é desenhado nele, então o que se vê é o que bloqueia.
+ */
+typedef struct BlockingZone {
+    u16 id;                 // Chave da zona na fase (ex: índice do trigger no Tiled)
     bool active;
-    Box hitbox;
+    Box hitbox;             // Alinhado aos tiles
+    Vect2D_s16 tileMin;     // Primeiro tile coberto
+    u16 tilesW, tilesH;
+    u8* savedTiles;         // tilesW * tilesH valores originais do mapa (arena da fase)
     Sprite* sprite;
     bool visible;
+    bool posSynced;         // FALSE força a próxima escrita de posição
+    Vect2D_s16 screenPos;   // Última posição escrita no sprite
 } BlockingZone;
 
 void blocking_clearAll();
-BlockingZone* blocking_create(s16 x, s16 y, s16 w, s16 h);
+BlockingZone* blocking_create(u16 id, s16 x, s16 y, s16 w, s16 h);
+BlockingZone* blocking_get(u16 id); // NULL = ainda não criada nesta fase
+void blocking_drawAll(); // Posiciona/esconde os sprites das zonas pela câmera
 void blocking_enable(BlockingZone* zone);
 void blocking_disable(BlockingZone* zone);
-void physics_checkBlockingZones(RigidBody* body);
 void blocking_setVisible(BlockingZone* zone, bool visible) ;
+void blocking_setScreenPosition(BlockingZone* zone, s16 x, s16 y);
 
 #endif
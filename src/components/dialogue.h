@@ -5,11 +5,30 @@
 #define DIALOGUE_H
 
 #include <genesis.h>
+#include "core/text_bank.h"
 
 // -----------------------------------------------------------------------------
 // Tipos principais
 // -----------------------------------------------------------------------------
 
+// Maior área de texto (dentro da borda) que a sombra em RAM comporta
+#define DIALOGUE_TEXT_MAX_W   38
+#define DIALOGUE_TEXT_MAX_H   8
+// Caixa completa (texto + borda), montada em RAM a cada passo da animação
+#define DIALOGUE_BOX_MAX_W    (DIALOGUE_TEXT_MAX_W + 2)
+#define DIALOGUE_BOX_MAX_H    (DIALOGUE_TEXT_MAX_H + 2)
+// Tiles de VRAM da caixa (cantos, bordas e centro) a partir de boxBaseTile
+#define DIALOGUE_BOX_TILES    9
+// Fonte proporcional: tiles de VRAM da área de texto (visW * visH da maior caixa)
+// e anel de tiles em RAM onde os glifos são compostos (potência de 2)
+#define DIALOGUE_VWF_VRAM_TILES 128
+#define DIALOGUE_VWF_BUFFERS    4
+// Escolhas do bytecode ({choice ...}) e paleta padrão da opção em destaque.
+// PAL3 fica reservada ao destaque: nenhum sprite ou prefab deve carregar nela
+// (ver dialogue_setChoicePal para usar outra por fase)
+#define DIALOGUE_MAX_CHOICES    4
+#define DIALOGUE_CHOICE_PAL     PAL3
+
 typedef enum
 {
     BOX_OPEN   = 0,
@@ -19,9 +38,14 @@ typedef enum
 
 typedef struct {
     bool active;
+    // Plano de desenho: BG_B (padrão) ou WINDOW, que não toca nos planos do jogo
+    VDPPlane plane;
+    u16 windowRow;              // Primeira linha (tiles) do WINDOW; 0 = modo BG_B
     // Fontes
     u16 fontPalette;
     const Image* font;
+    u16 fontBase;               // Tile do glifo ' ' (TILE_FONT_INDEX ou base do subconjunto)
+    const TextBank *fontBank;   // Banco do setFontSubset: glyphs dele = ASCII - 32 -> tile (NULL = fonte inteira)
 
     // Tiles da caixa
     u16 boxBaseTile;
@@ -30,17 +54,53 @@ typedef struct {
     u16 txtX, txtY;
     u16 visW, visH;
 
-    // Estado da impressão
+    // Estado da impressão: string em RAM/ROM (src) ou texto do banco (src NULL)
     const char *src;
     u16 i;
+    TextCursor cursor;
+    char cur;                   // Próximo caractere já decodificado do banco
     u16 curCol, curRow;
     u16 frameCnt;
     bool finished;
 
+    // Estado do bytecode (TEXT_OP_* em core/text_bank.h)
+    u16 speed;                  // Quadros por caractere
+    u16 waitFrames;
+    u16 textPal;                // Paleta dos próximos glifos
+    u16 choiceCount;            // > 0: esperando dialogue_choose
+    u16 choiceSel;              // Opção em destaque
+    u16 choicePalette;          // Paleta da opção em destaque (DIALOGUE_CHOICE_PAL)
+    u16 choiceMarks;            // Opções já impressas (TEXT_OP_OPTION) antes do TEXT_OP_CHOICE
+    s16 choiceRows[DIALOGUE_MAX_CHOICES + 1];   // Linha onde cada opção começa (+ fim); a rolagem desconta
+    u16 choiceIds[DIALOGUE_MAX_CHOICES];
+
+    // Fonte proporcional (VWF): glifos da ROM compostos em RAM, sem VDP_loadFont
+    bool vwf;
+    const u32 *vwfGlyphs;
+    u8 vwfMetrics[96];          // Avanço e recuo de cada glifo, medidos no setFontVwf
+    u16 vwfBaseTile;
+    u16 vwfTopSlot;             // Faixa do anel de VRAM mostrada na primeira linha
+    u16 penX;                   // Pixel da caneta na linha atual
+    u8 vwfCur;                  // Buffer da caneta no anel de RAM
+    u32 vwfBuf[DIALOGUE_VWF_BUFFERS][8];
+
+    // Sombra da área de texto: glifos e rolagem acontecem em RAM e só as
+    // linhas alteradas vão para a VDP, uma transferência por frame
+    u16 shadow[DIALOGUE_TEXT_MAX_W * DIALOGUE_TEXT_MAX_H];
+    u16 dirtyFirst, dirtyLast;  // Faixa de linhas a enviar (0xFFFF = nada)
+
     // Estado da caixa
     u8 cornerToggle;
     u8 updateBoxCtr;
 
+    // Animação de abrir/fechar: um passo a cada boxDelay frames, via dialogue_boxUpdate
+    bool boxAnimating;
+    BoxAnimMode boxMode;
+    s16 boxStep;                // Tamanho atual (tiles) da caixa animada
+    u16 boxDelay, boxDelayCnt;
+    u16 boxX, boxY, boxW, boxH;
+    u16 boxBuf[DIALOGUE_BOX_MAX_W * DIALOGUE_BOX_MAX_H];
+
     // Backup de fundo
     u16 *bgBackup;
     u16 bgX, bgY, bgW, bgH;
@@ -53,6 +113,15 @@ typedef struct {
 
 void dialogue_init(DialogueState *dlg, u16 fontPal, u16 boxBaseTile);
 void dialogue_setFont(DialogueState *dlg, const Image* font, u16 pal);
+void dialogue_useWindow(DialogueState *dlg, u16 row);   // row 0 volta ao BG_B
+// Só os glifos usados pelo banco de textos, em bank->glyphCount tiles a partir de vramBase
+// Os textos por ID precisam vir desse mesmo banco (textbank_use): outro banco é recusado
+void dialogue_setFontSubset(DialogueState *dlg, const Image* font, u16 pal, u16 vramBase, const TextBank *bank);
+// Fonte proporcional: tileset sem compressão, DIALOGUE_VWF_VRAM_TILES a partir de vramBase
+void dialogue_setFontVwf(DialogueState *dlg, const Image* font, u16 pal, u16 vramBase);
+// Paleta do destaque das escolhas; colors (16 cores) é enviado para ela se não for NULL.
+// Não pode ser uma paleta que algum sprite da fase usa
+void dialogue_setChoicePal(DialogueState *dlg, u16 pal, const u16 *colors);
 
 // -----------------------------------------------------------------------------
 // Backup / restauração de fundo
@@ -67,6 +136,7 @@ void dialogue_restoreBackground(DialogueState *dlg);
 
 void dialogue_boxOpenCenter(DialogueState *dlg, u16 x, u16 y, u16 w, u16 h, u16 baseTile, u16 pal, u16 delayFrm);
 void dialogue_boxCloseCenter(DialogueState *dlg, u16 x, u16 y, u16 w, u16 h, u16 baseTile, u16 pal, u16 delayFrm);
+bool dialogue_boxUpdate(DialogueState *dlg);   // TRUE quando não há animação em curso
 void dialogue_boxToggleCorners(DialogueState *dlg, u16 x, u16 y, u16 w, u16 h, u16 baseTile, u16 pal);
 
 // -----------------------------------------------------------------------------
@@ -74,6 +144,17 @@ void dialogue_boxToggleCorners(DialogueState *dlg, u16 x, u16 y, u16 w, u16 h, u
 // -----------------------------------------------------------------------------
 
 void dialogue_beginText(DialogueState *dlg, u16 x, u16 y, u16 w, u16 h, const char *text);
+void dialogue_beginTextId(DialogueState *dlg, u16 x, u16 y, u16 w, u16 h, u16 textId);
 bool dialogue_updateText(DialogueState *dlg);
+void dialogue_flushText(DialogueState *dlg);
+void dialogue_choiceMove(DialogueState *dlg, s16 dir);  // Troca a opção em destaque
+void dialogue_choose(DialogueState *dlg);                // Salta para o texto da opção
+
+// Passos da fonte proporcional, chamados pelo dialogue_text.c
+void dialogue_vwfBegin(DialogueState *dlg);
+void dialogue_vwfNewLine(DialogueState *dlg);
+void dialogue_vwfScroll(DialogueState *dlg);
+u16  dialogue_vwfAdvance(const DialogueState *dlg, char c);
+void dialogue_vwfPutChar(DialogueState *dlg, char c);
 
 #endif // DIALOGUE_H
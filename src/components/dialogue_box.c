@@ -12,79 +12,122 @@ static const CornerInfo s_cornerMap[2][4] = {
     { {6,1,0}, {8,1,1}, {0,1,1}, {2,1,0} }   // invertido
 };
 
-static void putTile(u16 x, u16 y, u16 base, u16 pal, u8 tile, u8 hf, u8 vf) {
-    VDP_setTileMapXY(BG_B, TILE_ATTR_FULL(pal, 1, hf, vf, base + tile), x, y);
+static void putTile(VDPPlane plane, u16 x, u16 y, u16 base, u16 pal, u8 tile, u8 hf, u8 vf) {
+    VDP_setTileMapXY(plane, TILE_ATTR_FULL(pal, 1, hf, vf, base + tile), x, y);
 }
 
-static void fillRect(u16 x, u16 y, u16 w, u16 h, u16 base, u16 pal) {
-    for (u16 ty = 0; ty < h; ty++)
-        for (u16 tx = 0; tx < w; tx++)
-            putTile(x + tx, y + ty, base, pal, 4, 0, 0);
-}
-
-static void drawCorners(u16 x, u16 y, u16 w, u16 h, u16 base, u16 pal, u8 toggle) {
+static void drawCorners(VDPPlane plane, u16 x, u16 y, u16 w, u16 h, u16 base, u16 pal, u8 toggle) {
     u16 rx = x + w - 1;
     u16 by = y + h - 1;
 
     const CornerInfo *ci = &s_cornerMap[toggle][0];
-    putTile(x,  y,  base, pal, ci->tile, ci->hf, ci->vf);
+    putTile(plane, x,  y,  base, pal, ci->tile, ci->hf, ci->vf);
     ci = &s_cornerMap[toggle][1];
-    putTile(rx, y,  base, pal, ci->tile, ci->hf, ci->vf);
+    putTile(plane, rx, y,  base, pal, ci->tile, ci->hf, ci->vf);
     ci = &s_cornerMap[toggle][2];
-    putTile(x,  by, base, pal, ci->tile, ci->hf, ci->vf);
+    putTile(plane, x,  by, base, pal, ci->tile, ci->hf, ci->vf);
     ci = &s_cornerMap[toggle][3];
-    putTile(rx, by, base, pal, ci->tile, ci->hf, ci->vf);
+    putTile(plane, rx, by, base, pal, ci->tile, ci->hf, ci->vf);
 }
 
-static void drawBox(u16 x, u16 y, u16 w, u16 h, u16 base, u16 pal, u8 cornerTog) {
-    for (u16 tx = 1; tx < w - 1; tx++) {
-        putTile(x + tx, y,         base, pal, 1, 0, 0);
-        putTile(x + tx, y + h - 1, base, pal, 7, 0, 0);
+// Monta em boxBuf a área inteira com uma caixa de s x s (limitada a w x h) no centro
+static void buildStep(DialogueState *dlg, s16 s) {
+    const u16 w = dlg->boxW, h = dlg->boxH;
+    const u16 base = dlg->boxBaseTile, pal = dlg->fontPalette;
+    u16 *buf = dlg->boxBuf;
+
+    const u16 fill = TILE_ATTR_FULL(pal, 1, 0, 0, base + 4);
+    for (u16 k = 0; k < w * h; k++) buf[k] = fill;
+    if (s < 1) return;
+
+    const u16 cw = (s > w) ? w : s;
+    const u16 ch = (s > h) ? h : s;
+    const u16 dx = w / 2 - cw / 2;
+    const u16 dy = h / 2 - ch / 2;
+    u16 *top = &buf[dy * w + dx];
+    u16 *bottom = &buf[(dy + ch - 1) * w + dx];
+
+    for (u16 tx = 1; tx < cw - 1; tx++) {
+        top[tx]    = TILE_ATTR_FULL(pal, 1, 0, 0, base + 1);
+        bottom[tx] = TILE_ATTR_FULL(pal, 1, 0, 0, base + 7);
     }
-    for (u16 ty = 1; ty < h - 1; ty++) {
-        putTile(x,         y + ty, base, pal, 3, 0, 0);
-        putTile(x + w - 1, y + ty, base, pal, 5, 0, 0);
+    for (u16 ty = 1; ty < ch - 1; ty++) {
+        top[ty * w]          = TILE_ATTR_FULL(pal, 1, 0, 0, base + 3);
+        top[ty * w + cw - 1] = TILE_ATTR_FULL(pal, 1, 0, 0, base + 5);
     }
-    drawCorners(x, y, w, h, base, pal, cornerTog);
+
+    const CornerInfo *ci = s_cornerMap[dlg->cornerToggle];
+    top[0]         = TILE_ATTR_FULL(pal, 1, ci[0].hf, ci[0].vf, base + ci[0].tile);
+    top[cw - 1]    = TILE_ATTR_FULL(pal, 1, ci[1].hf, ci[1].vf, base + ci[1].tile);
+    bottom[0]      = TILE_ATTR_FULL(pal, 1, ci[2].hf, ci[2].vf, base + ci[2].tile);
+    bottom[cw - 1] = TILE_ATTR_FULL(pal, 1, ci[3].hf, ci[3].vf, base + ci[3].tile);
+}
+
+static void startAnim(DialogueState *dlg, BoxAnimMode mode, u16 x, u16 y, u16 w, u16 h, u16 base, u16 pal, u16 delay) {
+    if (w > DIALOGUE_BOX_MAX_W) w = DIALOGUE_BOX_MAX_W;
+    if (h > DIALOGUE_BOX_MAX_H) h = DIALOGUE_BOX_MAX_H;
+
+    dlg->boxX = x;
+    dlg->boxY = y;
+    dlg->boxW = w;
+    dlg->boxH = h;
+    dlg->boxBaseTile = base;
+    dlg->fontPalette = pal;
+    dlg->boxMode = mode;
+    dlg->boxStep = (mode == BOX_OPEN) ? 1 : ((w > h) ? w : h);
+    dlg->boxDelay = delay;
+    dlg->boxDelayCnt = 0;   // Primeiro passo já no próximo update
+    dlg->boxAnimating = TRUE;
 }
 
+// Não bloqueia: só agenda a animação, que avança em dialogue_boxUpdate
 void dialogue_boxOpenCenter(DialogueState *dlg, u16 x, u16 y, u16 w, u16 h, u16 base, u16 pal, u16 delay) {
-    const u16 cx = x + w / 2;
-    const u16 cy = y + h / 2;
-    for (u16 s = 1; s <= ((w > h) ? w : h); s += 2) {
-        u16 cw = (s > w) ? w : s;
-        u16 ch = (s > h) ? h : s;
-        u16 dx = cx - cw / 2;
-        u16 dy = cy - ch / 2;
-
-        fillRect(x, y, w, h, base, pal);
-        drawBox(dx, dy, cw, ch, base, pal, dlg->cornerToggle);
-
-        for (u16 d = 0; d < delay; ++d) SYS_doVBlankProcess();
-    }
+    startAnim(dlg, BOX_OPEN, x, y, w, h, base, pal, delay);
 }
 
 void dialogue_boxCloseCenter(DialogueState *dlg, u16 x, u16 y, u16 w, u16 h, u16 base, u16 pal, u16 delay) {
-    const u16 cx = x + w / 2;
-    const u16 cy = y + h / 2;
-    for (s16 s = ((w > h) ? w : h); s >= 1; s -= 2) {
-        fillRect(x, y, w, h, base, pal);
-        u16 cw = (s > w) ? w : s;
-        u16 ch = (s > h) ? h : s;
-        u16 dx = cx - cw / 2;
-        u16 dy = cy - ch / 2;
+    startAnim(dlg, BOX_CLOSE, x, y, w, h, base, pal, delay);
+}
+
+/**
+ * Um passo da animação por chamada (respeitando o delay): monta a caixa em
+ * RAM e envia a área inteira com uma transferência. Chamar uma vez por frame.
+ */
+bool dialogue_boxUpdate(DialogueState *dlg) {
+    if (!dlg->boxAnimating) return TRUE;
+    if (dlg->boxDelayCnt) {
+        dlg->boxDelayCnt--;
+        return FALSE;
+    }
+    dlg->boxDelayCnt = dlg->boxDelay ? dlg->boxDelay - 1 : 0;
+
+    const s16 maxStep = (dlg->boxW > dlg->boxH) ? dlg->boxW : dlg->boxH;
+    bool last;
+    if (dlg->boxMode == BOX_OPEN) {
+        buildStep(dlg, dlg->boxStep);
+        last = dlg->boxStep >= maxStep;
+        dlg->boxStep += 2;
+    } else {
+        buildStep(dlg, dlg->boxStep);   // Passo < 1: só o preenchimento
+        last = dlg->boxStep < 1;
+        dlg->boxStep -= 2;
+    }
+
+    VDP_setTileMapDataRect(dlg->plane, dlg->boxBuf, dlg->boxX, dlg->boxY,
+                           dlg->boxW, dlg->boxH, dlg->boxW, DMA_QUEUE);
 
-        drawBox(dx, dy, cw, ch, base, pal, dlg->cornerToggle);
+    if (!last) return FALSE;
 
+    dlg->boxAnimating = FALSE;
+    if (dlg->boxMode == BOX_CLOSE) {
         dlg->active = FALSE;
-        
-        for (u16 d = 0; d < delay; ++d) SYS_doVBlankProcess();
+        if (dlg->plane == WINDOW) VDP_setWindowOff();
+        //else dialogue_restoreBackground(dlg);
     }
-    fillRect(x, y, w, h, base, pal);
-    //dialogue_restoreBackground(dlg);
+    return TRUE;
 }
 
 void dialogue_boxToggleCorners(DialogueState *dlg, u16 x, u16 y, u16 w, u16 h, u16 base, u16 pal) {
     dlg->cornerToggle ^= 1;
-    drawCorners(x, y, w, h, base, pal, dlg->cornerToggle);
+    drawCorners(dlg->plane, x, y, w, h, base, pal, dlg->cornerToggle);
 } 
@@ -2,6 +2,9 @@
 // -----------------------------------------------------------------------------
 #include "dialogue.h"
 #include <genesis.h>
+#include "core/logger.h"
+
+#define FONT_GLYPHS 96  // ASCII 32..127, como o VDP_loadFont
 
 // -----------------------------------------------------------------------------
 // Inicializa o estado do diálogo com fonte padrão
@@ -16,6 +19,13 @@ void dialogue_init(DialogueState *dlg, u16 fontPal, u16 boxBaseTile)
     dlg->bgBackup       = NULL;
     dlg->hasBackup      = FALSE;
     dlg->finished       = TRUE;
+    dlg->boxAnimating   = FALSE;
+    dlg->vwf            = FALSE;
+    dlg->fontBase       = TILE_FONT_INDEX;
+    dlg->fontBank       = NULL;
+    dlg->plane          = BG_B;
+    dlg->windowRow      = 0;
+    dlg->choicePalette  = DIALOGUE_CHOICE_PAL;
 
 }
 
@@ -26,4 +36,60 @@ void dialogue_setFont(DialogueState *dlg, const Image* font, u16 pal)
 {
     VDP_loadFont(font->tileset, DMA);
     dlg->fontPalette = pal;
-} 
+    dlg->vwf = FALSE;
+    dlg->fontBase = TILE_FONT_INDEX;
+    dlg->fontBank = NULL;
+}
+
+// -----------------------------------------------------------------------------
+// Paleta da opção em destaque: os glifos da opção são redesenhados nela
+// -----------------------------------------------------------------------------
+void dialogue_setChoicePal(DialogueState *dlg, u16 pal, const u16 *colors)
+{
+    if (pal == dlg->fontPalette)
+        debug_log("Dialogo: destaque na paleta da fonte nao aparece");
+    dlg->choicePalette = pal;
+    if (colors) PAL_setPalette(pal, colors, DMA);
+}
+
+// -----------------------------------------------------------------------------
+// Carrega só os glifos que os textos do banco imprimem (tabela gerada pelo
+// TextBankCompiler). Glifos seguidos no ASCII vão numa única transferência.
+// -----------------------------------------------------------------------------
+void dialogue_setFontSubset(DialogueState *dlg, const Image* font, u16 pal, u16 vramBase, const TextBank *bank)
+{
+    const TileSet *ts = font->tileset;
+    if (ts->compression != COMPRESSION_NONE || ts->numTile < FONT_GLYPHS)
+    {
+        debug_log("Dialogo: subconjunto precisa de fonte com %d tiles sem compressao", FONT_GLYPHS);
+        dialogue_setFont(dlg, font, pal);
+        return;
+    }
+
+    const u8 *remap = bank->glyphs;
+    u16 i = 0;
+    while (i < FONT_GLYPHS)
+    {
+        if (remap[i] == TEXTBANK_GLYPH_UNUSED) { i++; continue; }
+
+        u16 run = 1;
+        while (i + run < FONT_GLYPHS && remap[i + run] != TEXTBANK_GLYPH_UNUSED) run++;
+        VDP_loadTileData(ts->tiles + (i << 3), vramBase + remap[i], run, DMA);
+        i += run;
+    }
+
+    dlg->fontPalette = pal;
+    dlg->vwf = FALSE;
+    dlg->fontBase = vramBase;
+    dlg->fontBank = bank;
+}
+
+// -----------------------------------------------------------------------------
+// Desenha no WINDOW, dividido na linha `row` (a caixa deve ficar abaixo dela).
+// Sem backup/restauração: o plano do jogo nunca é tocado. row 0 volta ao BG_B.
+// -----------------------------------------------------------------------------
+void dialogue_useWindow(DialogueState *dlg, u16 row)
+{
+    dlg->windowRow = row;
+    dlg->plane = row ? WINDOW : BG_B;
+}
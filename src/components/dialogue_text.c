@@ -3,8 +3,9 @@
 #include "dialogue.h"
 #include <genesis.h>
 #include "core/logger.h"
+#include "core/game_config.h"
 
-const u32 dialog_box_tiles[9][8] = {
+const u32 dialog_box_tiles[DIALOGUE_BOX_TILES][8] = {
     // Tile 0: canto superior esquerdo
     { 0x00000000, 0x01111110, 0x01222210, 0x01222210, 0x01222210, 0x01222210, 0x01111110, 0x00000000 },
     // Tile 1: borda superior
@@ -25,37 +26,68 @@ const u32 dialog_box_tiles[9][8] = {
     { 0x00000000, 0x01111110, 0x01222210, 0x01222210, 0x01222210, 0x01222210, 0x01111110, 0x00000000 },
 };
 
-#define TXT_SPEED      4    // caracteres por quadro
+#define TXT_SPEED      4    // quadros por caractere ({speed N} muda durante o texto)
+#define DIRTY_NONE     0xFFFF
 
-static void scrollUp(DialogueState *dlg)
+// Tile do glifo na fonte carregada; fora do subconjunto da cena vira espaço
+static inline u16 fontTile(const DialogueState *dlg, char c)
 {
-    for (u16 ty = 1; ty < dlg->visH; ++ty)
-        for (u16 tx = 0; tx < dlg->visW; ++tx)
-        {
-            u16 addr = VDP_getPlaneAddress(BG_B, dlg->txtX + tx, dlg->txtY + ty);
-            vu16 *ctrl = (vu16 *)VDP_CTRL_PORT;
-            vu16 *data = (vu16 *)VDP_DATA_PORT;
-            *ctrl = (addr & 0x3FFF);
-            *ctrl = 0x0000 | (addr >> 14);
-            u16 t = *data;
-            VDP_setTileMapXY(BG_B, t, dlg->txtX + tx, dlg->txtY + ty - 1);
-        }
+    if (!dlg->fontBank) return dlg->fontBase + (c - 32);
 
-    const u16 blank = TILE_ATTR_FULL(dlg->fontPalette, 0, 0, 0, TILE_FONT_INDEX + (' ' - 32));
-    for (u16 tx = 0; tx < dlg->visW; ++tx)
-        VDP_setTileMapXY(BG_B, blank, dlg->txtX + tx, dlg->txtY + dlg->visH - 1);
+    const u8 *remap = dlg->fontBank->glyphs;
+    const u8 slot = remap[(u8)(c - 32)];
+    return dlg->fontBase + (slot == TEXTBANK_GLYPH_UNUSED ? remap[0] : slot);
 }
 
-void dialogue_beginText(DialogueState *dlg, u16 x, u16 y, u16 w, u16 h, const char *text)
+static void markDirty(DialogueState *dlg, u16 first, u16 last)
 {
-    if (dlg->active) return;
+    if (dlg->dirtyLast == DIRTY_NONE)
+    {
+        dlg->dirtyFirst = first;
+        dlg->dirtyLast = last;
+        return;
+    }
+    if (first < dlg->dirtyFirst) dlg->dirtyFirst = first;
+    if (last > dlg->dirtyLast) dlg->dirtyLast = last;
+}
+
+// Rolagem só na sombra: copia as linhas para cima e limpa a última
+static void scrollUp(DialogueState *dlg)
+{
+    const u16 w = dlg->visW;
+    u16 *row = dlg->shadow;
+    for (u16 ty = 1; ty < dlg->visH; ++ty, row += w)
+        memcpy(row, row + w, w * sizeof(u16));
 
+    // Sem fonte na VRAM, a linha nova volta ao tile central da caixa
+    u16 blank;
+    if (dlg->vwf)
+    {
+        dialogue_vwfScroll(dlg);
+        blank = TILE_ATTR_FULL(dlg->fontPalette, 1, 0, 0, dlg->boxBaseTile + 4);
+    }
+    else
+        blank = TILE_ATTR_FULL(dlg->fontPalette, 0, 0, 0, fontTile(dlg, ' '));
+    for (u16 tx = 0; tx < w; ++tx)
+        row[tx] = blank;
+
+    // Opções já impressas sobem junto com o texto
+    for (u16 k = 0; k < dlg->choiceMarks; ++k)
+        dlg->choiceRows[k]--;
+
+    markDirty(dlg, 0, dlg->visH - 1);
+}
+
+static void beginBox(DialogueState *dlg, u16 x, u16 y, u16 w, u16 h)
+{
     dlg->active = TRUE; 
     
     dlg->txtX = x + 1;
     dlg->txtY = y + 1;
     dlg->visW = w - 2;
     dlg->visH = h - 2;
+    if (dlg->visW > DIALOGUE_TEXT_MAX_W) dlg->visW = DIALOGUE_TEXT_MAX_W;
+    if (dlg->visH > DIALOGUE_TEXT_MAX_H) dlg->visH = DIALOGUE_TEXT_MAX_H;
     
     dlg->bgX = x;
     dlg->bgY = y;
@@ -63,24 +95,168 @@ void dialogue_beginText(DialogueState *dlg, u16 x, u16 y, u16 w, u16 h, const ch
     dlg->bgH = h;
     //dialogue_backupBackground(dlg, x, y, w, h);
 
-    VDP_clearTileMapRect(BG_B, dlg->txtX, dlg->txtY, dlg->visW, dlg->visH);
+    if (dlg->plane == WINDOW)
+    {
+        // Limpa as linhas do WINDOW (escrita só, sem leitura) e liga a divisão
+        VDP_clearTileMapRect(WINDOW, 0, dlg->windowRow, SCREEN_WIDTH / 8, SCREEN_HEIGHT / 8 - dlg->windowRow);
+        VDP_setWindowVPos(TRUE, dlg->windowRow);
+    }
+    else
+        VDP_clearTileMapRect(BG_B, dlg->txtX, dlg->txtY, dlg->visW, dlg->visH);
 
-    dlg->i = 0;
-    dlg->src = text;
     dlg->curCol = dlg->curRow = 0;
+    if (dlg->vwf) dialogue_vwfBegin(dlg);
     dlg->frameCnt = 0;
     dlg->finished = FALSE;
+    dlg->speed = TXT_SPEED;
+    dlg->waitFrames = 0;
+    dlg->textPal = dlg->fontPalette;
+    dlg->choiceCount = 0;
+    dlg->choiceMarks = 0;
+
+    // A abertura da caixa preenche a área com o tile central: a sombra começa igual
+    const u16 fill = TILE_ATTR_FULL(dlg->fontPalette, 1, 0, 0, dlg->boxBaseTile + 4);
+    for (u16 k = 0; k < dlg->visW * dlg->visH; ++k)
+        dlg->shadow[k] = fill;
+    dlg->dirtyFirst = DIRTY_NONE;
+    dlg->dirtyLast = DIRTY_NONE;
 
-    VDP_loadTileData(&dialog_box_tiles[0][0], dlg->boxBaseTile, 9, DMA);
+    VDP_loadTileData(&dialog_box_tiles[0][0], dlg->boxBaseTile, DIALOGUE_BOX_TILES, DMA);
 
     dialogue_boxOpenCenter(dlg, x, y, w, h, dlg->boxBaseTile, dlg->fontPalette, 2);
 }
 
-bool dialogue_updateText(DialogueState *dlg)
+void dialogue_beginText(DialogueState *dlg, u16 x, u16 y, u16 w, u16 h, const char *text)
+{
+    if (dlg->active) return;
+
+    dlg->i = 0;
+    dlg->src = text;
+    beginBox(dlg, x, y, w, h);
+}
+
+// Texto do banco da cena: decodificado um caractere por vez durante a impressão
+void dialogue_beginTextId(DialogueState *dlg, u16 x, u16 y, u16 w, u16 h, u16 textId)
+{
+    if (dlg->active) return;
+    // Subconjunto de outro banco: os glifos deste texto podem não estar na VRAM
+    if (dlg->fontBank && dlg->fontBank != textbank_current())
+    {
+        debug_log("Dialogo: fonte carregada de outro banco (texto %d)", textId);
+        return;
+    }
+    if (!textbank_open(&dlg->cursor, textId)) return;
+
+    dlg->src = NULL;
+    dlg->cur = textbank_next(&dlg->cursor);
+    beginBox(dlg, x, y, w, h);
+}
+
+static inline char peekChar(DialogueState *dlg)
+{
+    return dlg->src ? dlg->src[dlg->i] : dlg->cur;
+}
+
+static inline void nextChar(DialogueState *dlg)
+{
+    if (dlg->src) dlg->i++;
+    else dlg->cur = textbank_next(&dlg->cursor);
+}
+
+static void newLine(DialogueState *dlg)
+{
+    dlg->curCol = 0;
+    if (dlg->vwf) dialogue_vwfNewLine(dlg);
+    dlg->curRow++;
+    if (dlg->curRow >= dlg->visH) { scrollUp(dlg); dlg->curRow = dlg->visH - 1; }
+}
+
+// Continua a impressão no início do texto `id` do banco
+static void jumpTo(DialogueState *dlg, u16 id)
+{
+    textbank_open(&dlg->cursor, id);    // Falhou: o cursor só devolve '\0' e o texto acaba
+    dlg->src = NULL;
+    dlg->cur = textbank_next(&dlg->cursor);
+}
+
+static u8 readByte(DialogueState *dlg)
+{
+    u8 b = (u8)peekChar(dlg);
+    nextChar(dlg);
+    return b;
+}
+
+static u16 readId(DialogueState *dlg)
+{
+    u16 hi = readByte(dlg);
+    return (hi << 8) | readByte(dlg);
+}
+
+// Troca a paleta dos glifos de uma linha da sombra (o preenchimento da caixa fica como está)
+static void setRowPal(DialogueState *dlg, u16 row, u16 pal)
+{
+    const u16 fillTile = dlg->boxBaseTile + 4;
+    u16 *cell = &dlg->shadow[row * dlg->visW];
+    for (u16 tx = 0; tx < dlg->visW; ++tx)
+    {
+        if ((cell[tx] & TILE_INDEX_MASK) == fillTile) continue;
+        cell[tx] = (cell[tx] & ~TILE_ATTR_PALETTE_MASK) | (pal << TILE_ATTR_PALETTE_SFT);
+    }
+    markDirty(dlg, row, row);
+}
+
+// Todas as linhas da opção k (um rótulo longo quebra em mais de uma), só as visíveis
+static void setOptionPal(DialogueState *dlg, u16 k, u16 pal)
+{
+    s16 row = dlg->choiceRows[k] < 0 ? 0 : dlg->choiceRows[k];
+    for (; row < dlg->choiceRows[k + 1]; ++row)
+        setRowPal(dlg, row, pal);
+}
+
+static void execOp(DialogueState *dlg, u8 op)
+{
+    nextChar(dlg);
+    switch (op)
+    {
+        case TEXT_OP_SPEED: dlg->speed = readByte(dlg); break;
+        case TEXT_OP_WAIT:  dlg->waitFrames = readByte(dlg); break;
+        case TEXT_OP_PAL:   dlg->textPal = readByte(dlg); break;
+        case TEXT_OP_JUMP:  jumpTo(dlg, readId(dlg)); break;
+        case TEXT_OP_OPTION:
+            // Guarda a linha em que a opção começa, mesmo que o rótulo quebre depois
+            if (dlg->choiceMarks < DIALOGUE_MAX_CHOICES)
+                dlg->choiceRows[dlg->choiceMarks++] = dlg->curRow;
+            break;
+        case TEXT_OP_CHOICE:
+        {
+            const u16 n = readByte(dlg);
+            for (u16 k = 0; k < n; ++k)
+            {
+                u16 id = readId(dlg);
+                if (k < DIALOGUE_MAX_CHOICES) dlg->choiceIds[k] = id;
+            }
+            if (dlg->choiceMarks != n)
+                debug_log("Dialogo: escolha com %d opcoes e %d marcas", n, dlg->choiceMarks);
+            dlg->choiceCount = dlg->choiceMarks < n ? dlg->choiceMarks : n;
+            dlg->choiceRows[dlg->choiceCount] = dlg->curRow + 1;
+            dlg->choiceMarks = 0;
+            dlg->choiceSel = 0;
+            if (dlg->choiceCount) setOptionPal(dlg, 0, dlg->choicePalette);
+            break;
+        }
+        default:
+            debug_log("Dialogo: opcode %d desconhecido", op);
+            break;
+    }
+}
+
+static bool textStep(DialogueState *dlg)
 {
     if (dlg->finished) return TRUE;
+    if (dlg->choiceCount) return FALSE;
+    if (dlg->waitFrames) { dlg->waitFrames--; return FALSE; }
 
-    if (++dlg->frameCnt < TXT_SPEED) return FALSE;
+    if (++dlg->frameCnt < dlg->speed) return FALSE;
     dlg->frameCnt = 0;
 
     if (++dlg->updateBoxCtr == 4)
@@ -91,23 +267,75 @@ bool dialogue_updateText(DialogueState *dlg)
         dlg->updateBoxCtr = 0;
     }
 
-    char c = *(dlg->src + dlg->i);
+    // Opcodes não gastam um passo de impressão: roda todos até o próximo glifo
+    char c = peekChar(dlg);
+    while (c && (u8)c < 32 && c != '\n')
+    {
+        execOp(dlg, (u8)c);
+        if (dlg->waitFrames || dlg->choiceCount) return FALSE;
+        c = peekChar(dlg);
+    }
     if (!c) { dlg->finished = TRUE; return TRUE; }
 
-    if (c == '\n' || dlg->curCol >= dlg->visW)
+    const bool full = c == '\n' ? FALSE
+                    : dlg->vwf ? dlg->penX + dialogue_vwfAdvance(dlg, c) - 1 > (dlg->visW << 3)
+                    : dlg->curCol >= dlg->visW;
+    if (c == '\n' || full)
     {
-        dlg->curCol = 0;
-        dlg->curRow++;
-        if (dlg->curRow >= dlg->visH) { scrollUp(dlg); dlg->curRow = dlg->visH - 1; }
-        if (c == '\n') { dlg->i++; return FALSE; }
+        newLine(dlg);
+        if (c == '\n') { nextChar(dlg); return FALSE; }
     }
 
-    u16 tile = TILE_FONT_INDEX + (c - 32);
-    VDP_setTileMapXY(BG_B,
-        TILE_ATTR_FULL(dlg->fontPalette, 1, 0, 0, tile),
-        dlg->txtX + dlg->curCol, dlg->txtY + dlg->curRow);
+    if (dlg->vwf)
+        dialogue_vwfPutChar(dlg, c);
+    else
+    {
+        u16 tile = fontTile(dlg, c);
+        dlg->shadow[dlg->curRow * dlg->visW + dlg->curCol] = TILE_ATTR_FULL(dlg->textPal, 1, 0, 0, tile);
+    }
+    markDirty(dlg, dlg->curRow, dlg->curRow);
 
     dlg->curCol++;
-    dlg->i++;
+    nextChar(dlg);
     return FALSE;
 }
+
+void dialogue_choiceMove(DialogueState *dlg, s16 dir)
+{
+    if (!dlg->choiceCount) return;
+
+    setOptionPal(dlg, dlg->choiceSel, dlg->textPal);
+    dlg->choiceSel = (dlg->choiceSel + dlg->choiceCount + dir) % dlg->choiceCount;
+    setOptionPal(dlg, dlg->choiceSel, dlg->choicePalette);
+}
+
+void dialogue_choose(DialogueState *dlg)
+{
+    if (!dlg->choiceCount) return;
+
+    const u16 id = dlg->choiceIds[dlg->choiceSel];
+    dlg->choiceCount = 0;
+    newLine(dlg);
+    jumpTo(dlg, id);
+}
+
+// Envia as linhas alteradas da sombra num único retângulo (fila de DMA)
+void dialogue_flushText(DialogueState *dlg)
+{
+    if (dlg->dirtyLast == DIRTY_NONE) return;
+
+    const u16 rows = dlg->dirtyLast - dlg->dirtyFirst + 1;
+    VDP_setTileMapDataRect(dlg->plane, &dlg->shadow[dlg->dirtyFirst * dlg->visW],
+                           dlg->txtX, dlg->txtY + dlg->dirtyFirst,
+                           dlg->visW, rows, dlg->visW, DMA_QUEUE);
+
+    dlg->dirtyFirst = DIRTY_NONE;
+    dlg->dirtyLast = DIRTY_NONE;
+}
+
+bool dialogue_updateText(DialogueState *dlg)
+{
+    bool done = textStep(dlg);
+    dialogue_flushText(dlg);
+    return done;
+}
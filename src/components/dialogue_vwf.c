@@ -0,0 +1,139 @@
+// dialogue_vwf.c — Fonte proporcional (VWF) para os diálogos (Engine-SGDK)
+// -----------------------------------------------------------------------------
+// Os glifos são lidos direto do tileset da fonte em ROM (sem VDP_loadFont) e
+// compostos, deslocados ao pixel, num anel pequeno de tiles em RAM. Só os
+// tiles tocados pelo glifo atual vão para a VRAM.
+//
+// A área de texto ocupa visW * visH tiles de VRAM organizados em anel de
+// linhas: cada linha da caixa usa uma faixa de visW tiles e a rolagem só gira
+// qual faixa está no topo, sem reenviar nenhum tile.
+// -----------------------------------------------------------------------------
+#include "dialogue.h"
+#include <genesis.h>
+#include "core/logger.h"
+
+#define VWF_SPACE_ADVANCE   4   // Glifos vazios (espaço) não têm tinta para medir
+#define VWF_GLYPHS          96  // ASCII 32..127, mesma faixa do VDP_loadFont
+#define VWF_BLANK           0x80
+
+// Métrica de um glifo: avanço (bits 0-3), colunas vazias à esquerda (4-6), vazio (7)
+#define metricAdvance(m)    ((m) & 0x0F)
+#define metricLead(m)       (((m) >> 4) & 0x07)
+
+// Mede cada glifo uma vez: colunas vazias à esquerda e avanço (tinta + 1px)
+static void measureGlyphs(DialogueState *dlg)
+{
+    const u32 *g = dlg->vwfGlyphs;
+    for (u16 i = 0; i < VWF_GLYPHS; ++i, g += 8)
+    {
+        u32 ink = 0;
+        for (u16 r = 0; r < 8; ++r) ink |= g[r];
+
+        if (!ink)
+        {
+            dlg->vwfMetrics[i] = VWF_BLANK | VWF_SPACE_ADVANCE;
+            continue;
+        }
+
+        u16 first = 0, last = 7;
+        while (!(ink & (0xF0000000 >> (first << 2)))) first++;
+        while (!(ink & (0xF0000000 >> (last << 2)))) last--;
+        dlg->vwfMetrics[i] = (first << 4) | (last - first + 2);
+    }
+}
+
+void dialogue_setFontVwf(DialogueState *dlg, const Image* font, u16 pal, u16 vramBase)
+{
+    const TileSet *ts = font->tileset;
+    if (ts->compression != COMPRESSION_NONE || ts->numTile < VWF_GLYPHS)
+    {
+        debug_log("Dialogo: fonte VWF precisa de %d tiles sem compressao", VWF_GLYPHS);
+        dialogue_setFont(dlg, font, pal);
+        return;
+    }
+
+    dlg->vwf = TRUE;
+    dlg->fontBank = NULL;
+    dlg->vwfGlyphs = ts->tiles;
+    dlg->vwfBaseTile = vramBase;
+    dlg->fontPalette = pal;
+    measureGlyphs(dlg);
+}
+
+u16 dialogue_vwfAdvance(const DialogueState *dlg, char c)
+{
+    return metricAdvance(dlg->vwfMetrics[(u8)(c - 32)]);
+}
+
+void dialogue_vwfNewLine(DialogueState *dlg)
+{
+    dlg->penX = 0;
+    dlg->vwfCur = 0;
+    memset(dlg->vwfBuf[0], 0, sizeof(dlg->vwfBuf[0]));
+    memset(dlg->vwfBuf[1], 0, sizeof(dlg->vwfBuf[1]));
+}
+
+void dialogue_vwfBegin(DialogueState *dlg)
+{
+    if (dlg->visW * dlg->visH > DIALOGUE_VWF_VRAM_TILES)
+    {
+        debug_log("Dialogo: caixa VWF maior que %d tiles", DIALOGUE_VWF_VRAM_TILES);
+        dlg->visH = DIALOGUE_VWF_VRAM_TILES / dlg->visW;
+    }
+    dlg->vwfTopSlot = 0;
+    dialogue_vwfNewLine(dlg);
+}
+
+void dialogue_vwfScroll(DialogueState *dlg)
+{
+    // A faixa que saiu pelo topo passa a ser a da última linha
+    if (++dlg->vwfTopSlot >= dlg->visH) dlg->vwfTopSlot = 0;
+}
+
+static void uploadCell(DialogueState *dlg, const u32 *buf, u16 col)
+{
+    u16 slot = dlg->vwfTopSlot + dlg->curRow;
+    if (slot >= dlg->visH) slot -= dlg->visH;
+    const u16 tile = dlg->vwfBaseTile + slot * dlg->visW + col;
+
+    // DMA_QUEUE não copia: o buffer só é reescrito depois de girar o anel
+    VDP_loadTileData(buf, tile, 1, DMA_QUEUE);
+    dlg->shadow[dlg->curRow * dlg->visW + col] = TILE_ATTR_FULL(dlg->textPal, 1, 0, 0, tile);
+}
+
+void dialogue_vwfPutChar(DialogueState *dlg, char c)
+{
+    const u8 m = dlg->vwfMetrics[(u8)(c - 32)];
+    const u16 col = dlg->penX >> 3;
+    const u16 sub = dlg->penX & 7;
+    const u16 adv = metricAdvance(m);
+
+    u32 *cur = dlg->vwfBuf[dlg->vwfCur];
+    u32 *nxt = dlg->vwfBuf[(dlg->vwfCur + 1) & (DIALOGUE_VWF_BUFFERS - 1)];
+
+    if (!(m & VWF_BLANK))
+    {
+        const u32 *g = dlg->vwfGlyphs + ((u8)(c - 32) << 3);
+        const u16 lead = metricLead(m) << 2;
+        const u16 shift = sub << 2;
+        const bool spills = sub + adv - 1 > 8;   // Tinta passa para o tile seguinte
+
+        for (u16 r = 0; r < 8; ++r)
+        {
+            const u32 row = g[r] << lead;
+            cur[r] |= row >> shift;
+            if (spills) nxt[r] |= row << (32 - shift);
+        }
+
+        uploadCell(dlg, cur, col);
+        if (spills && col + 1 < dlg->visW) uploadCell(dlg, nxt, col + 1);
+    }
+
+    // A caneta avançou de tile: gira o anel e limpa o buffer à frente
+    dlg->penX += adv;
+    for (u16 k = col; k < (dlg->penX >> 3); ++k)
+    {
+        dlg->vwfCur = (dlg->vwfCur + 1) & (DIALOGUE_VWF_BUFFERS - 1);
+        memset(dlg->vwfBuf[(dlg->vwfCur + 1) & (DIALOGUE_VWF_BUFFERS - 1)], 0, sizeof(dlg->vwfBuf[0]));
+    }
+}
@@ -4,6 +4,16 @@
 #include "core/camera.h"
 #include "core/logger.h"
 #include "entities/npc_simple.h"
+#include "components/rigidbody.h"
+#include "core/spawner_def.h"
+#include "core/sprite_mux.h"
+#include "core/sprite_cache.h"
+#include "components/interact.h"
+#include "physics/physic_def.h"
+
+#if MAX_ENTITIES > HANDLE_MAX_SLOTS
+#error "MAX_ENTITIES nao cabe no indice do Handle"
+#endif
 
 void entity_setVisible(Entity* e, bool visible) ;
 void entity_getAABB(Entity* e, AABB* out);
@@ -12,6 +22,7 @@ Vect2D_s16 entity_getGlobalPosition(Entity* e);
 static Entity entityList[MAX_ENTITIES];
 static u16 nextFree;  // Próximo slot livre
 static u16 activeCount;  // Número de entidades ativas
+static u32 tickCount;    // Frames de lógica desde o init (base das políticas LOD e do tempo dos paths)
 extern DialogueState activeDialogue;
 
 void init_entity() {
@@ -20,9 +31,15 @@ void init_entity() {
         entityList[i].index = i + 1;  // Aponta para o próximo slot
     }
     entityList[MAX_ENTITIES - 1].index = 0xFFFF;  // Marca o fim
+
+    for (u16 i = 0; i < MAX_ENTITIES; i++) {
+        entityList[i].generation = 1;
+        entityList[i].active = FALSE;
+    }
     
     nextFree = 0;  // Primeiro slot livre
     activeCount = 0;
+    tickCount = 0;
 }
 
 Entity* entity_create(UpdatePolicy logicPolicy, UpdatePolicy drawPolicy) {
@@ -42,35 +59,78 @@ Entity* entity_create(UpdatePolicy logicPolicy, UpdatePolicy drawPolicy) {
     entity->joyHandle = NULL;
     entity->onUpdate = NULL;
     entity->onDraw = NULL;
+    entity->onDestroy = NULL;
+    entity->onEndPath = NULL;
+    entity->onInteract = NULL;
     entity->pData = NULL;
+    entity->flags = 0;
     entity->index = index;
-    entity->anim.sprite = NULL;
+    entity->spawnId = SPAWN_ID_NONE;
+    entity->anim = (AnimController){ 0 };
+    animcontroller_markDirty();   // quem cria normalmente adiciona um sprite em seguida
     entity->logicPolicy = logicPolicy;
     entity->drawPolicy = drawPolicy;
+    entity->lastTick = (u16)tickCount;
     activeCount++;
 
     debug_log("Info: Entidade criada com sucesso!");
     return entity;
 }
 
+u32 entity_getTick() {
+    return tickCount;
+}
+
 Entity* getEntity(u16 index) {
     if (index >= MAX_ENTITIES) return NULL;
     return &entityList[index];
 }
 
+EntityHandle entity_getHandle(const Entity* entity) {
+    if (!entity) return HANDLE_NULL;
+    return handle_make(entity->index, entity->generation);
+}
+
+Entity* entity_resolve(EntityHandle handle) {
+    u16 index = handle_index(handle);
+    if (index >= MAX_ENTITIES) return NULL;
+
+    Entity* e = &entityList[index];
+    if (e->generation != handle_generation(handle)) return NULL;
+    return e;
+}
+
 void entity_destroy(Entity* entity) {
     if (!entity) return;
     
     u16 index = entity->index;
+
+    if (entity->flags & FLAG_INTERACTABLE) interact_unregister(entity);
+    if (entity->onDestroy) entity->onDestroy(entity);
+
+    // Devolve o corpo e o sprite, o slot pode ser reciclado em seguida
+    if (entity->body) rigidbody_destroy(entity->body);
+    if (entity->anim.sprite) {
+        if (entity->anim.sharedVram) spriteCache_releaseSprite(entity->anim.sprite);
+        else SPR_releaseSprite(entity->anim.sprite);
+        animcontroller_markDirty();
+    }
     
     // Limpa a entidade
+    entity->active = FALSE;
+    entity->onDestroy = NULL;
     entity->body = NULL;
     entity->joyHandle = NULL;
     entity->onUpdate = NULL;
     entity->onDraw = NULL;
+    entity->onEndPath = NULL;
+    entity->onInteract = NULL;
     entity->pData = NULL;
     entity->anim.sprite = NULL;
     
+    // Invalida todos os handles que ainda apontam para este slot
+    entity->generation = handle_nextGeneration(entity->generation);
+
     // Adiciona à lista de livres
     entity->index = nextFree;
     nextFree = index;
@@ -79,6 +139,8 @@ void entity_destroy(Entity* entity) {
 }
 
 void update_all_entities() {
+    tickCount++;
+
     for (u16 i = 0; i < MAX_ENTITIES; i++) {
         Entity* e = &entityList[i];
 
@@ -87,13 +149,29 @@ void update_all_entities() {
         Vect2D_s16 pos = entity_getGlobalPosition(e);
         AABB aabb; entity_getAABB(e, &aabb);
 
+        u16 interval = update_policyInterval(e->logicPolicy);
+        if (interval > 1) {
+            // Longe da câmera: só roda no seu frame da vez (índice espalha a carga)
+            if (((tickCount + i) & (interval - 1)) && !should_update(&pos, &aabb, UPDATE_NEAR_CAMERA))
+                continue;
+
+            u16 frames = (u16)tickCount - e->lastTick;
+            if (frames > interval) frames = interval;
+            e->lastTick = (u16)tickCount;
+            e->onUpdate(e, frames);
+            continue;
+        }
+
         if (should_update(&pos, &aabb, e->logicPolicy)) {
-            e->onUpdate(e);
+            e->lastTick = (u16)tickCount;
+            e->onUpdate(e, 1);
         }
     }
 }
 
 void entity_drawAll() {
+    spriteMux_begin();
+
     for (u16 i = 0; i < MAX_ENTITIES; i++) {
         Entity* e = &entityList[i];
 
@@ -110,20 +188,28 @@ void entity_drawAll() {
         AABB aabb; entity_getAABB(e, &aabb);
 
         bool visible = should_update(&pos, &aabb, e->drawPolicy);
-        entity_setVisible(e, visible);
-        if (!visible) continue;
+        if (!visible) {
+            entity_setVisible(e, FALSE);
+            continue;
+        }
         
         s16 screenX = pos.x - camera_getPosition().x;
         s16 screenY = pos.y - camera_getPosition().y;
-        SPR_setPosition(e->anim.sprite, screenX, screenY);        
+        animcontroller_setPosition(&e->anim, screenX, screenY);
+        // SPR_update precisa rodar enquanto houver animação visível
+        if (animcontroller_isAnimating(&e->anim)) {
+            animcontroller_markDirty();
+            animcontroller_checkFrameEvents(e);
+        }
+        // Visibilidade final decidida pelo multiplexador (limite por scanline)
+        spriteMux_submit(e, screenY, e->tipo == ENTITY_TYPE_PLAYER);
     }
+
+    spriteMux_resolve();
 }
 
  void entity_setVisible(Entity* e, bool visible) {
-    if (e->anim.visible != visible) {
-        e->anim.visible = visible;
-        SPR_setVisibility(e->anim.sprite, visible ? VISIBLE : HIDDEN);
-    }
+    animcontroller_setVisible(&e->anim, visible);
 }
 
 void interact_with(Entity* target) {
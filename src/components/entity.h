@@ -15,6 +15,13 @@ void entity_destroy(Entity* entity);  // Libera a entidade de volta para o pool
 
 Entity* getEntity(u16 index);
 
+// Handles geracionais: seguros para guardar entre frames
+EntityHandle entity_getHandle(const Entity* entity);
+Entity* entity_resolve(EntityHandle handle);  // NULL se o slot foi reciclado
+
+// Frames de lógica desde init_entity (não conta pausa nem diálogo)
+u32 entity_getTick();
+
 // Atualização e renderização de todas as entidades
 void update_all_entities();
 void entity_drawAll();
@@ -26,14 +26,23 @@ typedef enum {
     ENTITY_EVENT_LAND,
     ENTITY_EVENT_JUMP,
     ENTITY_EVENT_HIT,
-    ENTITY_EVENT_DIE
+    ENTITY_EVENT_DIE,
+    ENTITY_EVENT_TRIGGER_ENTER,
+    ENTITY_EVENT_TRIGGER_EXIT,
+    ENTITY_EVENT_ANIM_FOOTSTEP,     // Eventos de quadro de animação (AnimFrameEvent)
+    ENTITY_EVENT_ANIM_HIT,
+    ENTITY_EVENT_ANIM_SPAWN,
+    ENTITY_EVENT_COUNT
 } EntityEventType;
 
 typedef struct Entity {    
     u16 index;  // Índice no array interno    
+    u16 generation; // Geração do slot (ver core/handle.h)
     bool active;
     bool wasOnGround;    
     u16 flags; // Flags de controle
+    u16 spawnId; // Ponto de spawn de origem (SPAWN_ID_NONE se criada à mão)
+    u16 lastTick; // Frame do último onUpdate (políticas LOD)
 
     EntityType tipo;    
     AnimController anim;
@@ -42,7 +51,7 @@ typedef struct Entity {
     UpdatePolicy drawPolicy;
     DialogueState* dialogue;
 
-    void (*onUpdate)(struct Entity*);
+    void (*onUpdate)(struct Entity*, u16 frames); // frames simulados nesta chamada (1, ou mais com LOD)
     void (*onDraw)(struct Entity*);
     void (*joyHandle)(u16 joy, u16 changed, u16 state);
     void (*onDestroy)(struct Entity*);
@@ -1,59 +1,165 @@
+/**
+ * @file interact.c
+ * @brief Busca do interagível sob o jogador (botão B)
+ *
+ * Itens, NPCs e placas não se movem: ficam num índice estático ordenado pelo
+ * x esquerdo da área de interação, montado conforme nascem. A consulta acha
+ * por busca binária a fatia em x ± INTERACT_RADIUS do jogador e só testa ela.
+ * Interagíveis com corpo em movimento vão para uma lista lateral pequena,
+ * testada inteira a cada consulta.
+ */
+
 #include "interact.h"
 #include "entity_def.h"
 #include "core/camera.h"
+#include "core/game_config.h"
 #include "physics/physic.h"
 #include "physics/physic_def.h"
 #include "components/entity.h"
 #include "core/logger.h"
 #include "entities/npc_simple.h"
 
-extern Entity entityList[MAX_ENTITIES];
+typedef struct {
+    s16 minX;               // Chave de ordenação
+    EntityHandle handle;
+} InteractEntry;
+
+static InteractEntry staticIndex[MAX_INTERACTABLES];
+static u16 staticCount;
+static u16 maxWidth;        // Maior largura já indexada: alarga o início da fatia
+
+static EntityHandle moving[MAX_MOVING_INTERACTABLES];
+static u16 movingCount;
+
+/**
+ * @brief Área de interação em coordenadas globais
+ * @return FALSE se a entidade não tem corpo nem hitbox conhecido
+ */
+static bool getInteractBounds(Entity* e, AABB* out) {
+    if (e->body) {
+        rigidbody_getGlobalAABB(e->body, out);
+        return TRUE;
+    }
+
+    Box* box;
+    switch (e->tipo) {
+        case ENTITY_TYPE_ITEM: box = &((ItemDef*)e->pData)->hitbox; break;
+        case ENTITY_TYPE_NPC:  box = &((NpcSimpleDef*)e->pData)->hitbox; break;
+        default: return FALSE;
+    }
+    out->min.x = box->x;
+    out->min.y = box->y;
+    out->max.x = box->x + box->w;
+    out->max.y = box->y + box->h;
+    return TRUE;
+}
+
+/**
+ * @brief Primeiro índice com minX >= value
+ */
+static u16 lowerBoundX(s16 value) {
+    u16 lo = 0, hi = staticCount;
+    while (lo < hi) {
+        u16 mid = (lo + hi) >> 1;
+        if (staticIndex[mid].minX < value) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+void interact_init() {
+    staticCount = 0;
+    maxWidth = 0;
+    movingCount = 0;
+}
+
+void interact_register(Entity* e, bool isMoving) {
+    if (isMoving) {
+        if (movingCount >= MAX_MOVING_INTERACTABLES) {
+            debug_log("Interact: lista de moveis cheia (%d)", MAX_MOVING_INTERACTABLES);
+            return;
+        }
+        moving[movingCount++] = entity_getHandle(e);
+        return;
+    }
+
+    AABB bounds;
+    if (!getInteractBounds(e, &bounds)) return;
+    if (staticCount >= MAX_INTERACTABLES) {
+        debug_log("Interact: indice cheio (%d)", MAX_INTERACTABLES);
+        return;
+    }
+
+    // Inserção ordenada: nascer é raro, consultar é o caso comum
+    u16 pos = lowerBoundX(bounds.min.x);
+    for (u16 i = staticCount; i > pos; i--) staticIndex[i] = staticIndex[i - 1];
+    staticIndex[pos].minX = bounds.min.x;
+    staticIndex[pos].handle = entity_getHandle(e);
+    staticCount++;
+
+    u16 width = bounds.max.x - bounds.min.x;
+    if (width > maxWidth) maxWidth = width;
+}
+
+void interact_unregister(Entity* e) {
+    EntityHandle h = entity_getHandle(e);
+
+    for (u16 i = 0; i < movingCount; i++) {
+        if (moving[i] != h) continue;
+        moving[i] = moving[--movingCount];
+        return;
+    }
+
+    // Busca pelo handle: o pData pode já ter sido liberado
+    for (u16 i = 0; i < staticCount; i++) {
+        if (staticIndex[i].handle != h) continue;
+        staticCount--;
+        for (; i < staticCount; i++) staticIndex[i] = staticIndex[i + 1];
+        if (!staticCount) maxWidth = 0;
+        return;
+    }
+}
+
+/**
+ * @brief Testa um candidato; chama onInteract se o jogador está sobre ele
+ */
+static bool tryCandidate(Entity* player, Entity* e, const AABB* playerAABB, Vect2D_f16 playerCenter, const AABB* cam) {
+    if (!e || !e->active || !e->onInteract) return FALSE;
+    if (!(e->flags & FLAG_INTERACTABLE)) return FALSE;
+    if (e->body && !(player->body->mask & (1 << e->body->layer))) return FALSE;
+
+    AABB bounds;
+    if (!getInteractBounds(e, &bounds)) return FALSE;
+    if (!aabb_intersect(&bounds, cam)) return FALSE;
+
+    Vect2D_f16 center = {
+        (bounds.min.x + bounds.max.x) >> 1,
+        (bounds.min.y + bounds.max.y) >> 1
+    };
+    if (!isNear(playerCenter, center, INTERACT_RADIUS)) return FALSE;
+    if (!aabb_intersect(playerAABB, &bounds)) return FALSE;
+
+    e->onInteract(e);
+    return TRUE;
+}
 
 void tryInteract(Entity* player) {
     const Vect2D_f16 playerCenter = getBodyCenter(player->body);
     const AABB* cam = camera_getScreenBounds();
+    AABB playerAABB;
+    rigidbody_getGlobalAABB(player->body, &playerAABB);
 
-    for (u16 i = 0; i < MAX_ENTITIES; i++) {
-        Entity* e = getEntity(i);
-        if (!e->active || !e->onInteract) continue;
-        if (!(e->flags & FLAG_INTERACTABLE)) continue;
-        
-        if (e->body) {         
-            if (!(player->body->mask & (1 << e->body->layer))) continue;   
-            if (!aabb_intersect(&e->body->aabb, cam)) continue;
-            if (!isNear(playerCenter, getBodyCenter(e->body), INTERACT_RADIUS)) continue;
-            if (aabb_intersect(&player->body->aabb, &e->body->aabb)) {
-                e->onInteract(e);
-                return;
-            }
-        }
-        
-        ItemDef* itemDef = NULL;
-        NpcSimpleDef* npcDef = NULL;
-        Box* box = NULL;
-
-        switch(e->tipo){
-            case ENTITY_TYPE_ITEM:
-                itemDef = (ItemDef*)e->pData; 
-                box = &itemDef->hitbox; break;
-            case ENTITY_TYPE_NPC:
-                npcDef = (NpcSimpleDef*)e->pData;
-                box = &npcDef->hitbox; break;
-            default:
-                box = NULL;
-        }
+    for (u16 i = 0; i < movingCount; i++) {
+        if (tryCandidate(player, entity_resolve(moving[i]), &playerAABB, playerCenter, cam)) return;
+    }
 
-        if (box) {  
-            if (!aabb_intersectBox(box, cam)) continue;   
-            if (!isNear(playerCenter, getBoxCenter(box), INTERACT_RADIUS)) continue;
-            AABB globalAABB;
-            rigidbody_getGlobalAABB(player->body, &globalAABB);
-            debug_log("Tipo: %d", e->tipo);
-            if (aabb_intersectBox(box, &globalAABB)) {
-                e->onInteract(e);
-                return;
-            }
-        }
+    // Fatia do índice que pode alcançar x ± raio do jogador
+    const s16 radius = F16_toInt(INTERACT_RADIUS);
+    u16 first = lowerBoundX(playerAABB.min.x - radius - maxWidth);
+    u16 last  = lowerBoundX(playerAABB.max.x + radius + 1);
+
+    for (u16 i = first; i < last; i++) {
+        if (tryCandidate(player, entity_resolve(staticIndex[i].handle), &playerAABB, playerCenter, cam)) return;
     }
 }
 
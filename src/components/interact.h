@@ -6,6 +6,11 @@
 // Distância padrão para interação (em pixels fix16)
 #define INTERACT_RADIUS FIX16(32)
 
+// Índice de interagíveis: estáticos ordenados por x, móveis numa lista lateral
+void interact_init();
+void interact_register(Entity* e, bool isMoving);
+void interact_unregister(Entity* e);
+
 void tryInteract(Entity* player);
 bool isNear(Vect2D_f16 a, Vect2D_f16 b, fix16 range);
 Vect2D_f16 getBodyCenter(RigidBody* body);
@@ -10,69 +10,148 @@
 #include "types.h"
 #include "trigger.h"
 #include "core/camera.h"
+#include "core/prefab.h"
+#include "entities/item.h"
+#include "entities/npc_simple.h"
+
+// PrefabDef.arg das plataformas: DistanceType + modo por tempo
+#define PLATFORM_ARG_DIST_MASK  0x00FF
+#define PLATFORM_ARG_TIMED      0x0100
+
+// Monta o PathFollower da plataforma `param` (platforms[] exportado do Tiled)
+static bool platform_prefabInit(Entity* entity, const PrefabDef* prefab, s16 x, s16 y, u16 param) {
+    const PathAgentDef* def = &platforms[param].agentDef;
+
+    const DistanceType distanceType = (DistanceType)(prefab->arg & PLATFORM_ARG_DIST_MASK);
+    const bool timed = (prefab->arg & PLATFORM_ARG_TIMED) != 0;
+
+    entity->body->aabb = newAABB(0, def->w, 0, def->h);
+    PathFollower* pf = path_follower_create(def, distanceType, timed);
+    if (!pf) return FALSE;
+    entity->pData = pf;
+
+    // Caminho sem modo por tempo (ONESHOT, curva, sem tabela): dormir longe
+    // da câmera congelaria a plataforma, então volta à política LOD
+    if (timed && !pf->timed) {
+        entity->logicPolicy = prefab_platforms[distanceType].logicPolicy;
+        entity->body->physicsPolicy = prefab_platforms[distanceType].logicPolicy;
+    }
+    return TRUE;
+}
+
+#define PLATFORM_PREFAB(distanceType, policy) {             \
+    .tipo = ENTITY_TYPE_PLATFORM,                           \
+    .flags = FLAG_IGNORE_GRAVITY | FLAG_CAN_RIDE,           \
+    .logicPolicy = (policy),                                \
+    .drawPolicy = UPDATE_VISIBLE_ONLY,                      \
+    .sprite = &spr_platform,                                \
+    .palette = PAL2,                                        \
+    .animSet = &defaultAnimSet,                             \
+    .hasBody = TRUE,                                        \
+    .layer = LAYER_PLATFORM,                                \
+    .mask = MASK_PLATFORM,                                  \
+    .tag = TAG_PLATFORM_MOVING,                             \
+    .bodyOffset = { 0, 8 },                                 \
+    .onUpdate = follower_update,                            \
+    .onDestroy = follower_onDestroy,                        \
+    .init = platform_prefabInit,                            \
+    .arg = (distanceType)                                   \
+}
+
+// Indexado por DistanceType
+// Longe da câmera rodam a cada 4 frames: o passo DDA para no alvo
+const PrefabDef prefab_platforms[] = {
+    [DIST_EUCLIDEAN] = PLATFORM_PREFAB(DIST_EUCLIDEAN, UPDATE_LOD_4),
+    [DIST_MANHATTAN] = PLATFORM_PREFAB(DIST_MANHATTAN, UPDATE_LOD_4),
+};
+
+// Posição pelo frame global: dorme longe da câmera e volta no lugar certo
+const PrefabDef prefab_platformTimed = PLATFORM_PREFAB(DIST_EUCLIDEAN | PLATFORM_ARG_TIMED, UPDATE_NEAR_CAMERA);
 
 Entity* spawn_entity_platform(u16 index, DistanceType distanceType) {
     const PathAgentDef* def = &platforms[index].agentDef; // Dados do parser
 
-    Entity* entity = entity_create(
-        UPDATE_ALWAYS,
-        UPDATE_VISIBLE_ONLY
-    );
-
-    RigidBody* body = rigidbody_create(
-        UPDATE_ALWAYS,
-        LAYER_PLATFORM,
-        MASK_PLATFORM,
-        TAG_PLATFORM_MOVING
-    );
-
-    body->active = TRUE;
-    body->collidable = TRUE; 
-    body->owner = entity;
-    body->globalPosition.x = def->position.x;
-    body->globalPosition.y = def->position.y + 8;
-    body->aabb = newAABB(0, def->w, 0, def->h);
-    body->centerOffset = newVector2D_u16((body->aabb.min.x + body->aabb.max.x) / 2,
-                                        (body->aabb.min.y + body->aabb.max.y) / 2);
-
-    AnimController anim = {.sprite = NULL, .visible = true, .animSet = &defaultAnimSet};
-
-    // --- entity ---    
-    entity->active = true;
-    entity->tipo = ENTITY_TYPE_PLATFORM;   
-    entity->flags = FLAG_IGNORE_GRAVITY | FLAG_CAN_RIDE;
-
-    // --- body ---
-    entity->body = body;
-
-    // --- SPRITE ---
-    entity->anim.animSet = &defaultAnimSet;
-    entity->anim.sprite = SPR_addSprite(&spr_platform, def->position.x, def->position.y, TILE_ATTR(PAL2, TRUE, FALSE, FALSE));
-    entity->anim.visible = true;
-    PAL_setPalette(PAL2, spr_platform.palette->data, DMA);
-    // --- Functions ---
-    entity->onUpdate = follower_update;
-
-    // --- PathFollower ---
-    entity->pData = path_follower_create(def, distanceType);
-        
-    // --- animcontroller ---
-    animcontroller_init(&entity->anim, entity->anim.sprite, anim.animSet);
-
-    return entity;
+    return prefab_spawn(&prefab_platforms[distanceType], def->position.x, def->position.y, index);
 }
 
-Entity* create_trigger_with_blocking_zone(Vect2D_u16 triggerPosition, Vect2D_u16 blockingPosition, 
-            const SpriteDefinition* triggerSprite, const SpriteDefinition* blockingSprite, 
-            TriggerZoneAction zoneAction, TriggerType triggerType, AnimStateSet* animStateSet, 
-            TriggerCallback onEnter, TriggerCallback onExit) {
+// Item `param` (Items[] do Tiled): hitbox no spawn com o tamanho do sprite do prefab
+static bool item_prefabInit(Entity* entity, const PrefabDef* prefab, s16 x, s16 y, u16 param) {
+    const Item_t* src = &Items[param];
+    ItemDef def = {
+        .name = src->nome,
+        .id = src->id,
+        .sprite = prefab->sprite,
+        .hitbox = { x, y, prefab->sprite->w, prefab->sprite->h },
+        .onCollect = NULL
+    };
+    return item_attach(entity, &def);
+}
 
-    BlockingZone* zone = blocking_create(blockingPosition.x, blockingPosition.y, 
-                                             blockingSprite->w, blockingSprite->h);
-    
-    zone->sprite = SPR_addSprite(blockingSprite, blockingPosition.x, blockingPosition.y, TILE_ATTR(PAL2, TRUE, FALSE, FALSE));
+// NPC `param` (npcs[] do Tiled): tamanho e falas vêm das propriedades do objeto
+static bool npc_prefabInit(Entity* entity, const PrefabDef* prefab, s16 x, s16 y, u16 param) {
+    const npc_t* src = &npcs[param];
+    NpcSimpleDef def = {
+        .hitbox = { x, y, src->agentDef.w, src->agentDef.h },
+        .textFirst = src->textFirst,
+        .textCount = src->textCount,
+        .textMode = (NpcTextMode)src->textMode
+    };
+    return npc_attach(entity, &def);
+}
 
-    return entity_spawnTrigger(0, triggerPosition, triggerType, zoneAction, onEnter, onExit, triggerSprite, zone);
+/* Trigger `param` (triggers[] do Tiled). A barreira fica com a fase: é criada
+ * no primeiro spawn e reaproveitada quando o trigger volta à janela, assim o
+ * estado (ligada/desligada) e os tiles carimbados sobrevivem ao despawn. */
+static bool trigger_prefabInit(Entity* entity, const PrefabDef* prefab, s16 x, s16 y, u16 param) {
+    const trigger_t* src = &triggers[param];
+    const SpriteDefinition* zoneSprite = (const SpriteDefinition*)prefab->data;
+    BlockingZone* zone = NULL;
+
+    if (src->zoneAction != TRIGGER_ZONE_NONE) {
+        zone = blocking_get(param);
+        if (!zone) {
+            zone = blocking_create(param, src->zoneX, src->zoneY, zoneSprite->w, zoneSprite->h);
+            if (!zone) return FALSE;
+            zone->sprite = SPR_addSprite(zoneSprite, src->zoneX, src->zoneY, TILE_ATTR(prefab->palette, TRUE, FALSE, FALSE));
+        }
+    }
+
+    Box hitbox = { x, y, prefab->sprite->w, prefab->sprite->h };
+    return trigger_attach(entity, hitbox, (TriggerType)src->type, (TriggerZoneAction)src->zoneAction,
+                          zone ? trigger_applyZoneAction_wrapper : NULL, NULL, zone);
 }
 
+const PrefabDef prefab_item = {
+    .tipo = ENTITY_TYPE_ITEM,
+    .flags = FLAG_INTERACTABLE,
+    .logicPolicy = UPDATE_DISABLED,
+    .drawPolicy = UPDATE_VISIBLE_ONLY,
+    .sprite = &spr_platform,
+    .palette = PAL2,
+    .onInteract = coletar_item,
+    .init = item_prefabInit
+};
+
+const PrefabDef prefab_npc = {
+    .tipo = ENTITY_TYPE_NPC,
+    .flags = FLAG_INTERACTABLE,
+    .logicPolicy = UPDATE_DISABLED,
+    .drawPolicy = UPDATE_VISIBLE_ONLY,
+    .sprite = &player_sheet,
+    .palette = PAL1,
+    .animSet = &defaultAnimSet,
+    .onInteract = npc_simple_onInteract,
+    .init = npc_prefabInit
+};
 
+const PrefabDef prefab_trigger = {
+    .tipo = ENTITY_TYPE_TRIGGER,
+    .flags = FLAG_TRIGGER,
+    .logicPolicy = UPDATE_VISIBLE_ONLY,
+    .drawPolicy = UPDATE_VISIBLE_ONLY,
+    .sprite = &spr_totem,
+    .palette = PAL2,
+    .animSet = &defaultAnimSet,
+    .init = trigger_prefabInit,
+    .data = &spr_platformV
+};
@@ -4,12 +4,18 @@
 #include <genesis.h>
 #include "components/entity_def.h"
 #include "components/path_def.h"
+#include "core/prefab_def.h"
+
+// Prefabs de plataforma (indexados por DistanceType) para tabelas de spawn
+extern const PrefabDef prefab_platforms[];
+// Plataforma LOOP/PINGPONG com posição calculada pelo frame global
+extern const PrefabDef prefab_platformTimed;
 
 Entity* spawn_entity_platform(u16 index, DistanceType distanceType) ;
 
-Entity* create_trigger_with_blocking_zone(Vect2D_u16 triggerPosition, Vect2D_u16 blockingPosition, 
-            const SpriteDefinition* triggerSprite, const SpriteDefinition* blockingSprite, 
-            TriggerZoneAction zoneAction, TriggerType triggerType, AnimStateSet* animStateSet, 
-            TriggerCallback onEnter, TriggerCallback onExit);
-            
+// Item, NPC e trigger com barreira: índice em Items[]/npcs[]/triggers[] do Tiled
+extern const PrefabDef prefab_item;
+extern const PrefabDef prefab_npc;
+extern const PrefabDef prefab_trigger;
+
 #endif
@@ -16,6 +16,30 @@ typedef enum {
     PATHMODE_INVALID
 } PATHMODE;
 
+/**
+ * Segmento pré-calculado pelo exportador do Tiled (TMXObjectParserSplitOutput)
+ *
+ * O segmento i vai de path[i] a path[(i + 1) % path_len]; o último é o
+ * fechamento usado no LOOP. Passos já vêm com a velocidade do agente
+ * aplicada, então o follower só soma: sem sqrt nem divisão em runtime.
+ * Percorrido ao contrário (PINGPONG voltando), basta negar o passo.
+ */
+typedef struct {
+    s16 stepX, stepY;       // Deslocamento por frame em 26.6
+    u16 steps;              // Frames para chegar ao fim do segmento
+} PathSegment;
+
+/**
+ * Curva (elipse ou spline) amostrada pelo exportador em passos iguais de
+ * comprimento: o follower só lê points[fase] a cada frame.
+ */
+typedef struct {
+    const Vect2D_u16* points;
+    u16 count;              // Amostras (<= 256)
+    u16 length;             // Comprimento total em px
+    bool closed;            // Último ponto emenda no primeiro (elipse, polígono)
+} PathCurve;
+
 /**
  * Obj extraido do tiled
  */
@@ -26,6 +50,8 @@ typedef struct {
     u8 delayInicial;
     u8 path_mode;           // PATH_MODE_LOOP, etc.
     fix16 velocidade;       // em FIX16
+    const PathSegment* segments; // path_len segmentos para esta velocidade (NULL = calcula em runtime)
+    const PathCurve* curve;      // Se não NULL, segue a curva em vez de path
     const char* sprite;     // nome do sprite (opcional)
     u8 w, h;                // dimensões (se tiver sprite)
 } PathAgentDef;
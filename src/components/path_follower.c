@@ -7,18 +7,39 @@
  * - LOOP: Repete o caminho indefinidamente
  * - PINGPONG: Vai e volta no caminho
  * - ONESHOT: Segue o caminho uma única vez
+ *
+ * Cada trecho até o próximo ponto é preparado uma vez (tabela do exportador
+ * ou pf_beginSegment, que faz a única divisão). Por frame o follower só soma
+ * o passo e acumula o erro como no Bresenham; a chegada vem de um contador
+ * de frames, sem recalcular distância.
  */
 
 #include "path_follower.h"
 #include "core/logger.h"
 #include "core/game_config.h"
 #include "entity.h"
-
-bool pathFollower_distanceManhattan(PathFollower* pf, fix16 velocidade, Vect2D_f16* outDelta);
-bool pathFollower_distanceEuclidean(PathFollower* pf, fix16 velPos, Vect2D_f16* out);
+#include "core/slab_pool.h"
 
 static u32 fastSqrt32(u32 v);
 
+static PathFollower followerStorage[MAX_PATH_FOLLOWERS];
+static SlabPool followerPool;
+
+/**
+ * @brief Reinicia o pool de PathFollower (chamar ao carregar a fase)
+ */
+void pathFollower_init() {
+    slab_init(&followerPool, followerStorage, sizeof(PathFollower), MAX_PATH_FOLLOWERS);
+}
+
+/**
+ * @brief Devolve o PathFollower da entidade ao pool (onDestroy)
+ * @param entity Entidade dona do PathFollower em pData
+ */
+void follower_onDestroy(Entity* entity) {
+    slab_free(&followerPool, entity->pData);
+}
+
 /**
  * @brief Avança para o próximo ponto no modo LOOP
  * @param pf PathFollower a ser atualizado
@@ -60,14 +81,297 @@ static void path_step_oneshot(PathFollower* pf) {
     }    
 }
 
+/**
+ * @brief Prepara o trecho até path[index] em runtime (caminhos sem tabela)
+ *
+ * Paga a divisão uma vez por trecho: o passo por frame vira uma parte
+ * inteira (stepX) e um resto (fracX) que se acumula em errX até valer mais
+ * 1/64 de pixel, como no Bresenham.
+ */
+void pf_beginSegment(PathFollower* pf) {
+    const Vect2D_u16* tgt = &pf->path[pf->index];
+    s16 dx = tgt->x - POS_TO_INT(pf->posX);
+    s16 dy = tgt->y - POS_TO_INT(pf->posY);
+    u16 adx = abs(dx);
+    u16 ady = abs(dy);
+
+    pf->dirX = (dx > 0) - (dx < 0);
+    pf->dirY = (dy > 0) - (dy < 0);
+    pf->errX = pf->errY = 0;
+
+    u16 len = (pf->distanceType == DIST_MANHATTAN) ? adx + ady
+                                                   : (u16)fastSqrt32((u32)adx * adx + (u32)ady * ady);
+    if (len == 0) {
+        // Já está no alvo: chega no próximo frame
+        pf->stepX = pf->stepY = 0;
+        pf->fracX = pf->fracY = 0;
+        pf->segLen = 1;
+        pf->stepsLeft = 0;
+        return;
+    }
+
+    u16 vel = (pf->velocidade > 0) ? pf->velocidade : 1;   // 26.6 por frame
+    u32 moveX = (u32)vel * adx;
+    u32 moveY = (u32)vel * ady;
+
+    pf->segLen = len;
+    pf->stepX = moveX / len;
+    pf->fracX = moveX % len;
+    pf->stepY = moveY / len;
+    pf->fracY = moveY % len;
+    pf->stepsLeft = ((u32)len * 64 + vel - 1) / vel;
+}
+
+/**
+ * @brief Prepara o trecho até path[index]: da tabela, se houver, senão em runtime
+ *
+ * Só usa a tabela se o follower está exatamente no ponto de partida do
+ * segmento (ex.: o primeiro trecho sai da posição de spawn, fora do caminho,
+ * e fica com pf_beginSegment).
+ */
+static void follower_beginLeg(PathFollower* pf) {
+    if (!pf->active || pf->path_len == 0) return;
+
+    if (pf->segments) {
+        u8 from;
+        if (pf->direction > 0) from = pf->index ? pf->index - 1 : pf->path_len - 1;
+        else                   from = pf->index + 1;
+
+        if (from < pf->path_len &&
+            INT_TO_POS(pf->path[from].x) == pf->posX && INT_TO_POS(pf->path[from].y) == pf->posY) {
+            // Indo para trás o segmento é o que sai do alvo: mesmo passo, negado
+            const PathSegment* seg = &pf->segments[pf->direction > 0 ? from : pf->index];
+            s16 sign = pf->direction;
+            pf->dirX = (seg->stepX > 0) ? sign : (seg->stepX < 0) ? -sign : 0;
+            pf->dirY = (seg->stepY > 0) ? sign : (seg->stepY < 0) ? -sign : 0;
+            pf->stepX = abs(seg->stepX);
+            pf->stepY = abs(seg->stepY);
+            pf->fracX = pf->fracY = 0;
+            pf->errX = pf->errY = 0;
+            pf->segLen = 1;
+            pf->stepsLeft = seg->steps;
+            return;
+        }
+    }
+
+    pf_beginSegment(pf);
+}
+
+/**
+ * @brief Chegou em path[index]: reinicia o delay e escolhe o próximo alvo
+ */
+static void follower_nextTarget(PathFollower* pf) {
+    pf->delay = pf->delayInicial;
+    switch (pf->path_mode) {
+        case PATHMODE_LOOP:     path_step_loop(pf); break;
+        case PATHMODE_PINGPONG: path_step_pingpong(pf); break;
+        case PATHMODE_ONESHOT:  path_step_oneshot(pf); break;
+    }
+    follower_beginLeg(pf);
+}
+
+/**
+ * @brief Modo curva: avança a fase e lê a posição da tabela
+ *
+ * Nas pontas da curva (ou ao fechar a volta, se fechada) o modo do caminho
+ * decide: LOOP recomeça, PINGPONG inverte, ONESHOT para. O delay vale ali.
+ * Numa curva aberta o LOOP volta ao início de uma vez.
+ */
+static bool follower_advanceCurve(PathFollower* pf, u16 frames, Vect2D_f16* out) {
+    const PathCurve* curve = pf->curve;
+    const s32 limit = (s32)(curve->closed ? curve->count : curve->count - 1) << 8;
+
+    pf->phase += (s32)pf->phaseStep * frames * pf->direction;
+
+    if (pf->phase >= limit || pf->phase <= 0) {
+        bool atEnd = pf->phase >= limit;
+        switch (pf->path_mode) {
+            case PATHMODE_LOOP:
+                pf->phase = atEnd ? pf->phase - limit : pf->phase + limit;
+                break;
+            case PATHMODE_PINGPONG:
+                pf->phase = atEnd ? limit : 0;
+                pf->direction = -pf->direction;
+                break;
+            default:
+                pf->phase = atEnd ? limit : 0;
+                pf->active = FALSE;
+                break;
+        }
+        pf->delay = pf->delayInicial;
+    }
+
+    u16 index = pf->phase >> 8;
+    if (index >= curve->count) index -= curve->count;   // Curva fechada: limit emenda no 0
+    const Vect2D_u16* p = &curve->points[index];
+
+    out->x = (fix16)(INT_TO_POS(p->x) - pf->posX);
+    out->y = (fix16)(INT_TO_POS(p->y) - pf->posY);
+    pf->posX = INT_TO_POS(p->x);
+    pf->posY = INT_TO_POS(p->y);
+    return true;
+}
+
+/**
+ * @brief Duração de uma volta do modo por tempo, ou 0 se o caminho não serve
+ *
+ * Precisa dos segmentos pré-calculados e de LOOP ou PINGPONG: cada trecho é
+ * o delay parado no ponto de saída seguido dos passos do segmento.
+ */
+static u16 follower_cycleFrames(const PathFollower* pf) {
+    if (!pf->segments || pf->curve || pf->path_len < 2) return 0;
+
+    u32 total = 0;
+    switch (pf->path_mode) {
+        case PATHMODE_LOOP:
+            for (u8 i = 0; i < pf->path_len; i++)
+                total += pf->delayInicial + pf->segments[i].steps;
+            break;
+        case PATHMODE_PINGPONG:
+            for (u8 i = 0; i < pf->path_len - 1; i++)
+                total += 2 * (pf->delayInicial + pf->segments[i].steps);
+            break;
+        default:
+            return 0;
+    }
+    return (total > 0xFFFF) ? 0 : (u16)total;
+}
+
+/**
+ * @brief Posição (26.6) no frame t da volta, sem simular os frames anteriores
+ *
+ * A volta começa parada em path[0]. No PINGPONG os trechos de volta usam os
+ * mesmos segmentos da ida, negados.
+ */
+static void follower_evalTimed(const PathFollower* pf, u16 t, s32* outX, s32* outY) {
+    const u8 n = pf->path_len;
+    const u8 legs = (pf->path_mode == PATHMODE_LOOP) ? n : 2 * (n - 1);
+
+    for (u8 leg = 0; leg < legs; leg++) {
+        bool back = leg >= n - 1 && pf->path_mode == PATHMODE_PINGPONG;
+        u8 seg = back ? legs - 1 - leg : leg;
+        u8 from = back ? seg + 1 : seg;
+        const Vect2D_u16* start = &pf->path[from];
+
+        if (t < pf->delayInicial) {
+            *outX = INT_TO_POS(start->x);
+            *outY = INT_TO_POS(start->y);
+            return;
+        }
+        t -= pf->delayInicial;
+
+        const PathSegment* s = &pf->segments[seg];
+        if (t < s->steps) {
+            s32 dx = (s32)s->stepX * t;
+            s32 dy = (s32)s->stepY * t;
+            *outX = INT_TO_POS(start->x) + (back ? -dx : dx);
+            *outY = INT_TO_POS(start->y) + (back ? -dy : dy);
+            return;
+        }
+        t -= s->steps;
+    }
+
+    // t == cycleFrames: fim da volta, de novo em path[0]
+    *outX = INT_TO_POS(pf->path[0].x);
+    *outY = INT_TO_POS(pf->path[0].y);
+}
+
+/**
+ * @brief Avança `frames` frames pelo trecho atual
+ *
+ * Só somas e comparações por frame. O último frame encosta no alvo exato,
+ * absorvendo o arredondamento do passo.
+ *
+ * A fração fica em posX/posY (e o resto do Bresenham em errX/errY): `out`
+ * leva só os pixels inteiros cruzados, em 26.6, que é o que o corpo
+ * consegue andar. Assim trechos lentos ou diagonais não perdem o resto.
+ * @return true se houve movimento ou o delay foi consumido
+ */
+static bool follower_advance(PathFollower* pf, u16 frames, Vect2D_f16* out) {
+    out->x = out->y = 0;
+    if (!pf->active || (pf->path_len == 0 && !pf->curve)) return false;
+
+    // Delay ativo? só decrementa
+    if (pf->delay) {
+        pf->delay--;
+        return true;
+    }
+
+    if (pf->curve) return follower_advanceCurve(pf, frames, out);
+
+    if (frames >= pf->stepsLeft) {
+        const Vect2D_u16* tgt = &pf->path[pf->index];
+        out->x = (fix16)INT_TO_POS(tgt->x - POS_TO_INT(pf->posX));
+        out->y = (fix16)INT_TO_POS(tgt->y - POS_TO_INT(pf->posY));
+        pf->posX = INT_TO_POS(tgt->x);
+        pf->posY = INT_TO_POS(tgt->y);
+        follower_nextTarget(pf);
+        return true;
+    }
+
+    s16 moveX = 0, moveY = 0;
+    for (u16 i = 0; i < frames; i++) {
+        moveX += pf->stepX;
+        pf->errX += pf->fracX;
+        if (pf->errX >= pf->segLen) { pf->errX -= pf->segLen; moveX++; }
+
+        moveY += pf->stepY;
+        pf->errY += pf->fracY;
+        if (pf->errY >= pf->segLen) { pf->errY -= pf->segLen; moveY++; }
+    }
+    if (pf->dirX < 0) moveX = -moveX;
+    if (pf->dirY < 0) moveY = -moveY;
+
+    s32 oldX = pf->posX;
+    s32 oldY = pf->posY;
+    pf->stepsLeft -= frames;
+    pf->posX += moveX;
+    pf->posY += moveY;
+    out->x = (fix16)INT_TO_POS(POS_TO_INT(pf->posX) - POS_TO_INT(oldX));
+    out->y = (fix16)INT_TO_POS(POS_TO_INT(pf->posY) - POS_TO_INT(oldY));
+    return true;
+}
+
+#if PATH_CHECK_LOOP
+/**
+ * @brief Confere que uma volta de LOOP devolve o corpo ao ponto de saída
+ *
+ * Simula numa cópia, frame a frame, somando os deltas que o corpo receberia
+ * entre duas chegadas em path[0]. Só vale para followers que nascem em
+ * path[0]; qualquer resto indica deriva a cada volta.
+ */
+static void follower_checkLoop(const PathFollower* pf) {
+    if (pf->path_mode != PATHMODE_LOOP || pf->curve || pf->path_len < 2) return;
+    if (pf->posX != INT_TO_POS(pf->path[0].x) || pf->posY != INT_TO_POS(pf->path[0].y)) return;
+
+    PathFollower sim = *pf;
+    s16 bodyX = 0, bodyY = 0;
+    u8 laps = 0;    // A primeira chegada é o trecho vazio a partir do spawn
+
+    for (u16 frame = 0; frame < 0xFFFF && laps < 2; frame++) {
+        u8 target = sim.index;
+        Vect2D_f16 delta;
+        follower_advance(&sim, 1, &delta);
+        bodyX += F16_toInt(delta.x);
+        bodyY += F16_toInt(delta.y);
+        if (target == 0 && sim.index != 0) laps++;
+    }
+
+    if (laps < 2 || bodyX || bodyY)
+        debug_log("PathFollower: volta do LOOP termina deslocada (%d, %d)", bodyX, bodyY);
+}
+#endif
+
 /**
  * @brief Cria um novo PathFollower
  * @param def Definição do PathFollower
  * @param distanceType Tipo de cálculo de distância a ser usado
+ * @param timed Posição calculada pelo frame global (LOOP/PINGPONG com tabela)
  * @return PathFollower* novo PathFollower criado
  */
-PathFollower* path_follower_create(const PathAgentDef* def, DistanceType distanceType) {
-    PathFollower* pf = (PathFollower*)MEM_alloc(sizeof(PathFollower));
+PathFollower* path_follower_create(const PathAgentDef* def, DistanceType distanceType, bool timed) {
+    PathFollower* pf = (PathFollower*)slab_alloc(&followerPool);
+    if (!pf) return NULL;
     pf->path = def->path;
     pf->path_len = def->path_len;
     pf->path_mode = def->path_mode;
@@ -76,31 +380,141 @@ PathFollower* path_follower_create(const PathAgentDef* def, DistanceType distanc
     pf->direction = 1;
     pf->delayInicial = def->delayInicial;
     pf->delay = def->delayInicial;
-    pf->distanceFunc = distanceType == DIST_MANHATTAN ? pathFollower_distanceManhattan : pathFollower_distanceEuclidean;
+    pf->distanceType = distanceType;
     pf->active = true;
     pf->posX = INT_TO_POS(def->position.x);
     pf->posY = INT_TO_POS(def->position.y);
-    pf->active = true;
+    // Tabelas do exportador usam comprimento euclidiano
+    pf->segments = distanceType == DIST_EUCLIDEAN ? def->segments : NULL;
+    follower_beginLeg(pf);
+
+    // Fase por frame: velocidade (26.6 px) * amostras / comprimento, em 24.8
+    pf->curve = def->curve;
+    pf->phase = 0;
+    if (pf->curve) {
+        u16 vel = (pf->velocidade > 0) ? pf->velocidade : 1;
+        u16 length = pf->curve->length ? pf->curve->length : 1;
+        pf->phaseStep = ((u32)vel * pf->curve->count * 4) / length;
+        if (!pf->phaseStep) pf->phaseStep = 1;
+    }
+
+    pf->cycleFrames = timed ? follower_cycleFrames(pf) : 0;
+    pf->timed = pf->cycleFrames != 0;
+    pf->synced = FALSE;
+    if (timed && !pf->timed)
+        debug_log("PathFollower: caminho sem suporte ao modo por tempo");
+
+#if PATH_CHECK_LOOP
+    if (!pf->timed) follower_checkLoop(pf);
+#endif
 
     return pf;
 }
 
+/**
+ * @brief Passo LOD: avança `frames` frames de uma vez (entidade longe da câmera)
+ *
+ * Move o corpo direto pelo delta e zera a velocidade, para ele não continuar
+ * andando sozinho entre um tick e outro.
+ */
+static void follower_updateCoarse(Entity* entity, PathFollower* pf, u16 frames) {
+    RigidBody* body = entity->body;
+
+    // O delay conta frames; deixa 1 para o próprio follower_advance consumir
+    if (pf->delay > 1)
+        pf->delay = (pf->delay > frames) ? pf->delay - (frames - 1) : 1;
+
+    Vect2D_f16 delta = { 0, 0 };
+    bool movedOrTicked = follower_advance(pf, frames, &delta);
+
+    body->velocity.fixX = 0;
+    body->velocity.fixY = 0;
+    body->velocity.x = 0;
+    body->delta = delta;
+
+    if(movedOrTicked) {
+        body->globalPosition.x += F16_toInt(delta.x);
+        body->globalPosition.y += F16_toInt(delta.y);
+
+        // ONESHOT (pontos ou curva) desliga o follower ao chegar no fim
+        if(entity->onEndPath && !pf->active) {
+            entity->onEndPath(entity);
+        }
+    }
+}
+
+/**
+ * @brief Modo por tempo: posição tirada do frame global
+ *
+ * Rodando todo frame só soma 1 na volta. Depois de dormir (ou ao nascer) faz
+ * um módulo e encaixa o corpo direto na posição certa, sem velocidade.
+ */
+static void follower_updateTimed(Entity* entity, PathFollower* pf) {
+    RigidBody* body = entity->body;
+    u32 now = entity_getTick();
+    u32 gap = now - pf->lastTick;
+    bool snap = !pf->synced || gap != 1;
+
+    if (!pf->synced || gap >= pf->cycleFrames) {
+        pf->cycleT = now % pf->cycleFrames;
+    } else {
+        pf->cycleT += gap;
+        if (pf->cycleT >= pf->cycleFrames) pf->cycleT -= pf->cycleFrames;
+    }
+    pf->lastTick = now;
+    pf->synced = TRUE;
+
+    s32 x, y;
+    follower_evalTimed(pf, pf->cycleT, &x, &y);
+
+    // Só os pixels inteiros cruzados: a fração fica em posX/posY
+    s16 dx = POS_TO_INT(x) - POS_TO_INT(pf->posX);
+    s16 dy = POS_TO_INT(y) - POS_TO_INT(pf->posY);
+
+    if (snap) {
+        // Salto pode passar do alcance do fix16: move em pixels
+        body->globalPosition.x += dx;
+        body->globalPosition.y += dy;
+        body->delta.x = body->delta.y = 0;
+        body->velocity.fixX = body->velocity.fixY = 0;
+        body->velocity.x = 0;
+    } else {
+        body->delta.x = (fix16)INT_TO_POS(dx);
+        body->delta.y = (fix16)INT_TO_POS(dy);
+        body->velocity.fixX = body->delta.x;
+        body->velocity.fixY = body->delta.y;
+        body->velocity.x = dx;
+    }
+    pf->posX = x;
+    pf->posY = y;
+}
+
 /**
  * @brief Atualiza a posição da entidade baseada no PathFollower
  * @param entity Entidade a ser atualizada
+ * @param frames Frames desde o último tick (LOD pode pular vários)
  * 
  * Esta função:
- * 1. Calcula o próximo movimento usando a função de distância
+ * 1. Calcula o próximo movimento (tabela de passos, DDA ou curva)
  * 2. Atualiza a posição da entidade
  * 3. Atualiza a animação se necessário
  * 4. Chama o callback onEndPath quando apropriado
  */
-void follower_update(Entity* entity) {
+void follower_update(Entity* entity, u16 frames) {
     PathFollower* pf = (PathFollower*)entity->pData;
 
+    if (pf->timed) {
+        follower_updateTimed(entity, pf);
+        return;
+    }
+
+    if(pf->active && frames > 1) {
+        follower_updateCoarse(entity, pf, frames);
+        return;
+    }
+
     if(pf->active) {
-        bool movedOrTicked = pf->distanceFunc(pf, pf->velocidade, &entity->body->delta);
-        //bool movedOrTicked = pathFollower_distanceEuclidean(pf, entity->velocidade, &entity->body->delta);
+        bool movedOrTicked = follower_advance(pf, 1, &entity->body->delta);
         
         if(movedOrTicked) {
             entity->body->velocity.fixX = entity->body->delta.x;
@@ -110,7 +524,7 @@ void follower_update(Entity* entity) {
             if(entity->tipo != ENTITY_TYPE_PLATFORM) 
                 animcontroller_update(&entity->anim, entity->body);
             
-            if(entity->onEndPath || (pf->path_mode == PATHMODE_ONESHOT && pf->index >= pf->path_len)) {
+            if(entity->onEndPath && !pf->active) {
                 entity->onEndPath(entity);
             }
         }
@@ -118,86 +532,6 @@ void follower_update(Entity* entity) {
     
 }
 
-/**
- * @brief Obtém a função de cálculo de distância baseada no tipo
- * @param type Tipo de cálculo de distância
- * @return DistanceFunc função de cálculo de distância
- */
-DistanceFunc getDistanceFunc(DistanceType type) {
-    switch (type) {
-        case DIST_MANHATTAN: return pathFollower_distanceManhattan;
-        case DIST_EUCLIDEAN:
-        default: return pathFollower_distanceEuclidean;
-    }
-}
-
-/**
- * @brief Calcula o movimento usando distância Manhattan
- * @param pf PathFollower
- * @param velocidade Velocidade de movimento
- * @param outDelta Vetor de saída com o delta de movimento
- * @return true se houve movimento
- */
-bool pathFollower_distanceManhattan(PathFollower* pf, fix16 velocidade, Vect2D_f16* outDelta) {
-    if (!pf || (!pf->active && pf->delay == 0) || pf->path_len == 0){
-        return false;
-    }
-    // Delay ativo? só decrementa
-    if (pf->delay > 0) {
-        pf->delay--;
-        outDelta->x = 0;
-        outDelta->y = 0;
-        return true;
-    }
-
-    const Vect2D_u16* target = &pf->path[pf->index];
-    s32 deltaX = INT_TO_POS(target->x) - pf->posX;
-    s32 deltaY = INT_TO_POS(target->y) - pf->posY;
-
-    // Se chegou próximo o suficiente do alvo
-    u32 distt = getApproximatedDistance(deltaX, deltaY);
-    if(distt <= 64/*abs(deltaX) <= 64 && abs(deltaY) <= 64*/){
-        // Atualiza posição exata
-        pf->posX = INT_TO_POS(target->x);
-        pf->posY = INT_TO_POS(target->y);
-        pf->delay = pf->delayInicial;
-        
-        // Atualiza próximo ponto do caminho
-        switch(pf->path_mode){
-            case PATHMODE_LOOP:     path_step_loop(pf); break;
-            case PATHMODE_PINGPONG: path_step_pingpong(pf); break;
-            case PATHMODE_ONESHOT:  path_step_oneshot(pf); break;
-        }
-
-        return false;
-    }
-    
-    s32 dist = abs(deltaX) + abs(deltaY);
-    
-    if(dist > 0){
-        s32 dirX = (deltaX > 0) ? 1 : ((deltaX < 0) ? -1 : 0);
-        s32 dirY = (deltaY > 0) ? 1 : ((deltaY < 0) ? -1 : 0);
-
-        fix32 ratioX = ((s32)abs(deltaX) << 16) / dist;
-        fix32 ratioY = ((s32)abs(deltaY) << 16) / dist;
-        
-        fix16 scaledVel = F16_mul(velocidade, FIX16(64));
-
-        fix16 dx = F16_mul(scaledVel, (dirX != 0) ? (fix16)((dirX * ratioX) >> 16) : 0);        
-        fix16 dy = F16_mul(scaledVel, (dirY != 0) ? (fix16)((dirY * ratioY) >> 16) : 0);
-
-        pf->posX += dx;
-        pf->posY += dy;
-
-        outDelta->x = dx;
-        outDelta->y = dy;
-
-        return true;
-    }
-
-    return false;
-}
-
 /**
  * @brief Calcula raiz quadrada inteira rapidamente
  * @param v Valor para calcular raiz quadrada
@@ -214,65 +548,3 @@ static u32 fastSqrt32(u32 v)
     }
     return r;
 }
-
-/**
- * @brief Calcula o movimento usando distância Euclidiana
- * @param pf PathFollower
- * @param velPos Velocidade de movimento
- * @param out Vetor de saída com o delta de movimento
- * @return true se houve movimento
- */
-bool pathFollower_distanceEuclidean(PathFollower* pf, fix16 velPos, Vect2D_f16* out)
-{
-    if (!pf || (!pf->active && pf->delay == 0) || pf->path_len == 0) return false;
-    if (pf->delay) { pf->delay--; out->x = out->y = 0; return true; }
-
-    /* delta em píxel inteiro ---------------------------------- */
-    const Vect2D_u16* tgt = &pf->path[pf->index];
-    s32 dPixX = (INT_TO_POS(tgt->x) - pf->posX) >> FIX16_FRAC_BITS;
-    s32 dPixY = (INT_TO_POS(tgt->y) - pf->posY) >> FIX16_FRAC_BITS;
-
-    /* chegou? -------------------------------------------------- */
-    if (abs(dPixX) <= 1 && abs(dPixY) <= 1)
-    {
-        pf->posX = INT_TO_POS(tgt->x);
-        pf->posY = INT_TO_POS(tgt->y);
-        pf->errX = pf->errY = 0;
-        pf->delay = pf->delayInicial;
-        switch (pf->path_mode) { case PATHMODE_LOOP: path_step_loop(pf); break;
-                                 case PATHMODE_PINGPONG: path_step_pingpong(pf); break;
-                                 case PATHMODE_ONESHOT: path_step_oneshot(pf); break; }
-        out->x = out->y = 0;
-        return true;
-    }
-
-    /* comprimento inteiro ------------------------------------- */
-    u32 dist = fastSqrt32((u32)abs(dPixX)*abs(dPixX) + (u32)abs(dPixY)*abs(dPixY));
-
-    /* passo desejado em px (≥1) --------------------------------*/
-    u32 step = F16_toInt(velPos);
-    if (step == 0) step = 1;
-    if (step >= dist) step = dist;        /* evita overshoot     */
-
-    /* erro acumulado (26.6) -- soma passo na escala global -----*/
-    pf->errX += (s32)dPixX * step;
-    pf->errY += (s32)dPixY * step;
-
-    /* decide quantos px avançar em cada eixo -------------------*/
-    s32 moveXpix = pf->errX / (s32)dist;
-    s32 moveYpix = pf->errY / (s32)dist;
-    pf->errX    -= moveXpix * (s32)dist;
-    pf->errY    -= moveYpix * (s32)dist;
-
-    /* converte para 26.6 e aplica ------------------------------*/
-    s32 dxPos = moveXpix << FIX16_FRAC_BITS;   /* *64 */
-    s32 dyPos = moveYpix << FIX16_FRAC_BITS;
-
-    pf->posX += (fix16)dxPos;
-    pf->posY += (fix16)dyPos;
-
-    out->x = (fix16)dxPos;
-    out->y = (fix16)dyPos;
-    return true;
-}
-
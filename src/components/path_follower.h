@@ -10,8 +10,6 @@
 struct Entity; // Forward declaration
 typedef struct PathFollower PathFollower;
 
-typedef bool (*DistanceFunc)(PathFollower* pf, fix16 velocidade, Vect2D_f16* outDelta);
-
 struct PathFollower{
     const Vect2D_u16* path;
     u8 path_len;
@@ -22,24 +20,39 @@ struct PathFollower{
     u8 delayInicial;
     fix16 velocidade;          // usada se mover via path
     bool active;
+    u8 distanceType;   // DistanceType: métrica do comprimento do segmento
     s32 posX, posY;    // posição atual (fix32)
-    s32 lastPosX, lastPosY;
-    s32 errX, errY;      /* 26.6 – restos acumulados          */
 
-    DistanceFunc distanceFunc;
-     /* ---- otimização ------------------------------------------------ */
-    /* dados válidos ENQUANTO não chegar ao alvo corrente */
+    /* ---- segmentos pré-calculados (PathAgentDef.segments) ----------- */
+    const PathSegment* segments;   /* NULL: só o cálculo em runtime      */
+
+    /* ---- modo curva (PathAgentDef.curve) ---------------------------- */
+    const PathCurve* curve;
+    s32 phase;             /* amostra atual em 24.8                  */
+    u32 phaseStep;         /* amostras por frame em 24.8             */
+
+    /* ---- modo por tempo (path_follower_create com timed) ------------ */
+    /* posição = f(frame global): pode dormir fora da tela              */
+    bool timed;
+    bool synced;           /* FALSE: próximo update encaixa direto   */
+    u16 cycleFrames;       /* duração de uma volta (delays + passos) */
+    u16 cycleT;            /* frame atual dentro da volta            */
+    u32 lastTick;          /* entity_getTick() do último update      */
+
+    /* ---- trecho atual (DDA) ----------------------------------------- */
+    /* preenchido uma vez por trecho, pela tabela ou por pf_beginSegment  */
     s16 dirX, dirY;        /* ±1 ou 0                                */
-    u16 remainPix;         /* distância restante em píxeis inteiros  */
-    fix16 ratioX;          /* |dx|/dist  em fix16 (0‥64)             */
-    fix16 ratioY;          /* |dy|/dist  em fix16 (0‥64)             */
-    u32 ratioX32, ratioY32;   /* razões 16.16 */
+    s16 stepX, stepY;      /* |passo| inteiro por frame em 26.6      */
+    u16 fracX, fracY;      /* resto do passo, somado a errX/errY     */
+    u16 segLen;            /* comprimento do trecho em px (divisor)  */
+    u16 errX, errY;        /* erro acumulado, sempre < segLen        */
+    u16 stepsLeft;         /* frames até o alvo                      */
 };
 
-PathFollower* path_follower_create(const PathAgentDef* def, DistanceType distanceType);
+PathFollower* path_follower_create(const PathAgentDef* def, DistanceType distanceType, bool timed);
 void pathFollower_init();
-void follower_update(struct Entity* entity);
+void follower_update(struct Entity* entity, u16 frames);
+void follower_onDestroy(struct Entity* entity);
 void pf_beginSegment(PathFollower* pf);
-DistanceFunc getDistanceFunc(DistanceType type);
 
 #endif // PATH_FOLLOWER_H 
\ No newline at end of file
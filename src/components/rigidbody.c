@@ -9,6 +9,10 @@
 #include "core/update_policy.h"
 #include "components/entity.h"
 
+#if MAX_BODIES > HANDLE_MAX_SLOTS
+#error "MAX_BODIES nao cabe no indice do Handle"
+#endif
+
 static RigidBody bodyList[MAX_BODIES];
 static u16 nextFree;  // Próximo slot livre
 static u16 activeCount;  // Número de corpos ativos
@@ -19,6 +23,11 @@ void rigidbody_init(){
         bodyList[i].index = i + 1;  // Aponta para o próximo slot
     }
     bodyList[MAX_BODIES - 1].index = 0xFFFF;  // Marca o fim
+
+    for (u16 i = 0; i < MAX_BODIES; i++) {
+        bodyList[i].generation = 1;
+        bodyList[i].active = FALSE;
+    }
     
     nextFree = 0;  // Primeiro slot livre
     activeCount = 0;
@@ -57,11 +66,11 @@ RigidBody* rigidbody_create(UpdatePolicy physicsPolicy, u8 layer, u8 mask, u16 t
     body->layer = layer;
     body->mask = mask;
     body->tag = tag;
-    body->owner = NULL;
+    body->owner = HANDLE_NULL;
     body->onCollision = NULL;
     body->onTrigger = NULL;
     body->physics = &defaultPhysicsParams;
-    body->support = NULL;
+    body->support = HANDLE_NULL;
     body->vState = VSTATE_AIRBORNE;
     body->mState = MSTATE_IDLE;
     body->aState = ASTATE_NONE;
@@ -101,16 +110,19 @@ void rigidbody_destroy(RigidBody* body) {
     body->layer = 0;
     body->mask = 0;
     body->tag = 0;
-    body->owner = NULL;
+    body->owner = HANDLE_NULL;
     body->onCollision = NULL;
     body->onTrigger = NULL;
     body->physics = NULL;
-    body->support = NULL;
+    body->support = HANDLE_NULL;
     body->vState = VSTATE_AIRBORNE;
     body->mState = MSTATE_IDLE;
     body->aState = ASTATE_NONE;
-    body->collidable = TRUE;
-    body->active = TRUE;
+    body->collidable = FALSE;
+    body->active = FALSE;
+
+    // Invalida todos os handles que ainda apontam para este slot
+    body->generation = handle_nextGeneration(body->generation);
     
     // Adiciona à lista de livres
     body->index = nextFree;
@@ -124,15 +136,29 @@ RigidBody* getRigidBody(u16 index){
     return &bodyList[index];
 }
 
+BodyHandle rigidbody_getHandle(const RigidBody* body) {
+    if (!body) return HANDLE_NULL;
+    return handle_make(body->index, body->generation);
+}
+
+RigidBody* rigidbody_resolve(BodyHandle handle) {
+    u16 index = handle_index(handle);
+    if (index >= MAX_BODIES) return NULL;
+
+    RigidBody* body = &bodyList[index];
+    if (body->generation != handle_generation(handle)) return NULL;
+    return body;
+}
+
 /*
  */
  void rigidbody_update(RigidBody* body) {
     if (!body || !body->active) return;
 
     Vect2D_s16 previous = body->globalPosition;
-    Entity* e = body->owner;
+    Entity* e = entity_resolve(body->owner);
     // Aplica gravidade apenas se não tiver a flag FLAG_IGNORE_GRAVITY
-    if(!(e->flags & FLAG_IGNORE_GRAVITY)){
+    if(e && !(e->flags & FLAG_IGNORE_GRAVITY)){
         if(body->velocity.fixY <= body->physics->maxFallSpeed)
             body->velocity.fixY += body->physics->gravity;
         else
@@ -31,6 +31,18 @@ void rigidbody_destroy(RigidBody* body); // Libera o corpo de volta para o pool
  * @return Pointer to the rigidbody at that index
  */
 RigidBody* getRigidBody(u16 index);
+/**
+ * Get the generational handle of a live rigidbody
+ * @param body The rigidbody (NULL gives HANDLE_NULL)
+ * @return Handle that stays valid until the body is destroyed
+ */
+BodyHandle rigidbody_getHandle(const RigidBody* body);
+/**
+ * Resolve a handle back to its rigidbody in O(1)
+ * @param handle Handle obtained from rigidbody_getHandle
+ * @return Pointer to the rigidbody, or NULL if the slot was recycled
+ */
+RigidBody* rigidbody_resolve(BodyHandle handle);
 /**
  * Update a rigidbody's physics state
  * Applies gravity and updates position based on velocity
@@ -5,6 +5,7 @@
 #include "xtypes.h"
 #include "core/game_config.h"
 #include "core/update_policy.h"
+#include "core/handle.h"
 
 typedef struct RigidBody
 {
@@ -28,12 +29,12 @@ typedef struct RigidBody
     u8 mask;  // Com quais grupos pode colidir
     u16 tag;  // Tipo específico de entidade (opcional)
 
-    void *owner;                                                          // Ponteiro para entidade dona
+    EntityHandle owner;                                                   // Handle da entidade dona
     void (*onCollision)(struct RigidBody *self, struct RigidBody *other); // Callback física
     void (*onTrigger)(struct RigidBody *self, struct RigidBody *other);   // Callback triggers
 
     EntityPhysicsParams *physics; // Referência à física base
-    struct RigidBody *support;    // Corpo abaixo (ex: plataforma)
+    BodyHandle support;           // Corpo abaixo (ex: plataforma)
 
     VerticalState vState;
     MovementState mState;
@@ -42,6 +43,7 @@ typedef struct RigidBody
     bool collidable; // Responde a colisões físicas
     bool active;     // Deve ser atualizado
     u16 index;       // Índice no array interno
+    u16 generation;  // Geração do slot (ver core/handle.h)
     
     UpdatePolicy physicsPolicy;
 } RigidBody;
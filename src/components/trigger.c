@@ -4,9 +4,11 @@
 #include "physics/physic.h"
 #include "components/blocking_zone.h"
 #include "core/camera.h"
+#include "core/slab_pool.h"
+#include "core/event_bus.h"
+#include "core/sprite_mux.h"
 
 void trigger_draw(Entity* self);
-void trigger_update(Entity* self);
 void trigger_applyZoneAction(TriggerDef* def);
 
 void myTriggerCallback(TriggerDef* def) {
@@ -21,136 +23,236 @@ void onExitCallback(TriggerDef* def) {
     debug_log("Trigger onExit!");
 }
 
-static Entity* target = NULL;
+#if MAX_BODIES > 16
+#error "TriggerDef.occupants e' u16: um bit por corpo"
+#endif
+#if MAX_TRIGGERS > 255 || TRIGGER_GRID_ENTRIES > 255
+#error "Indices da grade de triggers sao u8"
+#endif
+
+#define NO_ENTRY 0xFF
+
+static TriggerDef triggerDefStorage[MAX_TRIGGERS];
+static SlabPool triggerDefPool;
+
+/* Grade de ocupação: cada célula (hash) aponta para a lista dos triggers que
+ * a cobrem. Os volumes são carimbados no spawn e apagados no destroy; por
+ * frame só as células tocadas pelos corpos são visitadas. */
+typedef struct {
+    u8 trigger;     // Índice em triggerDefStorage
+    u8 next;        // Próxima entrada do bucket (NO_ENTRY = fim)
+} GridEntry;
+
+static u8 buckets[TRIGGER_GRID_BUCKETS];
+static GridEntry entries[TRIGGER_GRID_ENTRIES];
+static u8 freeEntry;
+
+static u8 occupied[MAX_TRIGGERS];   // Triggers com alguém dentro no último frame
+static u8 occupiedCount;
+static u8 touched[MAX_TRIGGERS];    // Triggers tocados neste frame
+static u8 touchedCount;
+
+static inline u16 cellHash(s16 cx, s16 cy) {
+    return ((u16)cx * 31 + (u16)cy) & (TRIGGER_GRID_BUCKETS - 1);
+}
+
+static void grid_insert(u16 bucket, u8 trigger) {
+    for (u8 i = buckets[bucket]; i != NO_ENTRY; i = entries[i].next)
+        if (entries[i].trigger == trigger) return;   // outra célula do mesmo bucket
+
+    if (freeEntry == NO_ENTRY) {
+        debug_log("Trigger: grade cheia (TRIGGER_GRID_ENTRIES %d)", TRIGGER_GRID_ENTRIES);
+        return;
+    }
+    u8 e = freeEntry;
+    freeEntry = entries[e].next;
+    entries[e].trigger = trigger;
+    entries[e].next = buckets[bucket];
+    buckets[bucket] = e;
+}
+
+static void grid_remove(u16 bucket, u8 trigger) {
+    u8* link = &buckets[bucket];
+    while (*link != NO_ENTRY) {
+        u8 e = *link;
+        if (entries[e].trigger == trigger) {
+            *link = entries[e].next;
+            entries[e].next = freeEntry;
+            freeEntry = e;
+            return;
+        }
+        link = &entries[e].next;
+    }
+}
 
-void trigger_setTarget(Entity* p) {
-    target = p;
+// Aplica insert/remove em todas as células cobertas pelo volume
+static void grid_stamp(const Box* box, u8 trigger, bool insert) {
+    s16 cx1 = box->x >> TRIGGER_CELL_SHIFT;
+    s16 cy1 = box->y >> TRIGGER_CELL_SHIFT;
+    s16 cx2 = (box->x + box->w - 1) >> TRIGGER_CELL_SHIFT;
+    s16 cy2 = (box->y + box->h - 1) >> TRIGGER_CELL_SHIFT;
+
+    for (s16 cy = cy1; cy <= cy2; cy++)
+        for (s16 cx = cx1; cx <= cx2; cx++) {
+            if (insert) grid_insert(cellHash(cx, cy), trigger);
+            else grid_remove(cellHash(cx, cy), trigger);
+        }
 }
 
-Entity* entity_spawnTrigger(u16 index, Vect2D_u16 position, TriggerType triggerType, TriggerZoneAction zoneAction, TriggerCallback onEnter, TriggerCallback onExit, SpriteDefinition* spriteDef, BlockingZone* zone) {
-    Entity* e = entity_create(UPDATE_VISIBLE_ONLY, UPDATE_VISIBLE_ONLY);
-    if (!e) return NULL;
+void trigger_init() {
+    slab_init(&triggerDefPool, triggerDefStorage, sizeof(TriggerDef), MAX_TRIGGERS);
+
+    for (u16 i = 0; i < TRIGGER_GRID_BUCKETS; i++) buckets[i] = NO_ENTRY;
+    for (u16 i = 0; i < TRIGGER_GRID_ENTRIES - 1; i++) entries[i].next = i + 1;
+    entries[TRIGGER_GRID_ENTRIES - 1].next = NO_ENTRY;
+    freeEntry = 0;
+    occupiedCount = 0;
+    touchedCount = 0;
+}
 
-    // obj do tiled
-    TriggerDef def = {
-        .hitbox = {position.x, position.y, spriteDef->w, spriteDef->h},
-        .type = triggerType,
-        .triggered = FALSE,
-        .zoneAction = zoneAction,
-        .onEnter = onEnter,
-        .onExit = onExit,
-        .context = (void*)zone
-    };
+void trigger_releaseZones() {
+    // Blocos livres só usam os 2 primeiros bytes (hitbox): zerar context não os afeta
+    for (u16 i = 0; i < MAX_TRIGGERS; i++)
+        triggerDefStorage[i].context = NULL;
+}
 
-    e->active = TRUE;
-    e->tipo = ENTITY_TYPE_TRIGGER;
-    e->flags = FLAG_TRIGGER;
+static void trigger_onDestroy(Entity* self) {
+    TriggerDef* def = (TriggerDef*)self->pData;
+    u8 id = def - triggerDefStorage;
 
-    TriggerDef* triggerDef = (TriggerDef*)MEM_alloc(sizeof(TriggerDef));
-    triggerDef->hitbox.x = def.hitbox.x;
-    triggerDef->hitbox.y = def.hitbox.y;
-    triggerDef->hitbox.w = def.hitbox.w;
-    triggerDef->hitbox.h = def.hitbox.h;
+    grid_stamp(&def->hitbox, id, FALSE);
+    for (u16 i = 0; i < occupiedCount; i++) {
+        if (occupied[i] == id) {
+            occupied[i] = occupied[--occupiedCount];
+            break;
+        }
+    }
+    slab_free(&triggerDefPool, def);
+}
+
+// Callbacks de enter/exit rodam na entrega do event bus, fora do update
+static void trigger_onEvent(Entity* self, EntityEventType type) {
+    TriggerDef* triggerDef = (TriggerDef*)self->pData;
+
+    if (type == ENTITY_EVENT_TRIGGER_ENTER && triggerDef->onEnter)
+        triggerDef->onEnter(triggerDef);
+    else if (type == ENTITY_EVENT_TRIGGER_EXIT && triggerDef->onExit)
+        triggerDef->onExit(triggerDef);
+}
+
+bool trigger_attach(Entity* e, Box hitbox, TriggerType triggerType, TriggerZoneAction zoneAction, TriggerCallback onEnter, TriggerCallback onExit, BlockingZone* zone) {
+    TriggerDef* triggerDef = (TriggerDef*)slab_alloc(&triggerDefPool);
+    if (!triggerDef) return FALSE;
+
+    triggerDef->hitbox = hitbox;
     triggerDef->triggered = FALSE;
-    triggerDef->type = def.type;
-    triggerDef->zoneAction = def.zoneAction;
+    triggerDef->type = triggerType;
+    triggerDef->zoneAction = zoneAction;
     triggerDef->context = (void*)zone;
     triggerDef->onEnter = onEnter;
     triggerDef->onExit = onExit;
-
-    AnimController anim = {.sprite = NULL, .visible = TRUE, .animSet = &defaultAnimSet}; 
-    if(spriteDef) 
-        anim.sprite =  SPR_addSprite(spriteDef, def.hitbox.x, def.hitbox.y, TILE_ATTR(PAL2, TRUE, FALSE, FALSE));
-    
-    e->anim = anim;
+    triggerDef->owner = entity_getHandle(e);
+    triggerDef->occupants = 0;
+    triggerDef->nextOccupants = 0;
+    grid_stamp(&triggerDef->hitbox, triggerDef - triggerDefStorage, TRUE);
 
     e->onInteract = NULL;
-    e->onUpdate = trigger_update;
+    e->onUpdate = NULL;     // detecção feita por trigger_updateAll (grade)
     e->onDraw = trigger_draw;
-    e->onDestroy = NULL;
+    e->onDestroy = trigger_onDestroy;
     e->onEndPath = NULL;
-    e->onEvent = NULL;
-
-    if(e->anim.sprite)
-    SPR_setPosition(e->anim.sprite, def.hitbox.x, def.hitbox.y);
+    e->onEvent = trigger_onEvent;
 
     debug_log("Trigger: Spawnado em: %d,%d", triggerDef->hitbox.x, triggerDef->hitbox.y);
 
     e->pData = triggerDef; 
     
-    return e;
+    return TRUE;
 }
 
-void trigger_update(Entity* self) {
-   
-    if (!self->active) return;
-    if (!target || !target->body) return;
-
-    AABB globalAABB;
-    rigidbody_getGlobalAABB(target->body, &globalAABB);
+// Volume saiu de vazio para ocupado
+static void trigger_enter(TriggerDef* triggerDef) {
+    if (triggerDef->triggered || !triggerDef->onEnter) return;
+    eventBus_push(entity_resolve(triggerDef->owner), ENTITY_EVENT_TRIGGER_ENTER);
+    triggerDef->triggered = TRUE;
+}
 
-    TriggerDef* triggerDef = (TriggerDef*)self->pData;
-    bool hit = aabb_intersectBox(&triggerDef->hitbox, &globalAABB);
+// Volume ficou vazio
+static void trigger_exit(TriggerDef* triggerDef) {
     switch (triggerDef->type) {
         case TRIGGER_TYPE_ONCE:
-            if (!triggerDef->triggered && hit && triggerDef->onEnter) {
-                triggerDef->onEnter(triggerDef);
-                triggerDef->triggered = TRUE;
-            }
             break;
 
         case TRIGGER_TYPE_REPEAT:
-            if (hit && !triggerDef->triggered && triggerDef->onEnter) {
-                triggerDef->onEnter(triggerDef);
-                triggerDef->triggered = TRUE;
-            }else if (!hit && triggerDef->triggered) {
-                triggerDef->triggered = FALSE;
-            }
+            triggerDef->triggered = FALSE;
             break;
 
         case TRIGGER_TYPE_ENTER_EXIT:
-            if (hit && !triggerDef->triggered && triggerDef->onEnter) {
-                triggerDef->onEnter(triggerDef);
-                triggerDef->triggered = TRUE;
-            } else if (!hit && triggerDef->triggered && triggerDef->onExit) {
-                triggerDef->onExit(triggerDef);
+            if (triggerDef->triggered && triggerDef->onExit) {
+                eventBus_push(entity_resolve(triggerDef->owner), ENTITY_EVENT_TRIGGER_EXIT);
                 triggerDef->triggered = FALSE;
             }
             break;
     }
 }
 
-void trigger_draw(Entity* self) {
-    TriggerDef* def = (TriggerDef*)self->pData;
-    BlockingZone* zone = (BlockingZone*)def->context;
+void trigger_updateAll() {
+    // 1. Corpos que enxergam triggers marcam os volumes das células que tocam
+    touchedCount = 0;
+    for (u16 b = 0; b < MAX_BODIES; b++) {
+        RigidBody* body = getRigidBody(b);
+        if (!body->active || !(body->mask & (1 << LAYER_TRIGGER))) continue;
+
+        AABB bounds;
+        rigidbody_getGlobalAABB(body, &bounds);
+        s16 cx1 = bounds.min.x >> TRIGGER_CELL_SHIFT;
+        s16 cy1 = bounds.min.y >> TRIGGER_CELL_SHIFT;
+        s16 cx2 = (bounds.max.x - 1) >> TRIGGER_CELL_SHIFT;
+        s16 cy2 = (bounds.max.y - 1) >> TRIGGER_CELL_SHIFT;
+
+        for (s16 cy = cy1; cy <= cy2; cy++)
+            for (s16 cx = cx1; cx <= cx2; cx++)
+                for (u8 i = buckets[cellHash(cx, cy)]; i != NO_ENTRY; i = entries[i].next) {
+                    TriggerDef* def = &triggerDefStorage[entries[i].trigger];
+                    if (def->nextOccupants & (1 << b)) continue;
+                    if (!aabb_intersectBox(&def->hitbox, &bounds)) continue;
+                    if (!def->nextOccupants) touched[touchedCount++] = entries[i].trigger;
+                    def->nextOccupants |= (1 << b);
+                }
+    }
 
+    // 2. Diferença de conjuntos: ocupados antes e vazios agora -> exit
+    for (u16 i = 0; i < occupiedCount; i++) {
+        TriggerDef* def = &triggerDefStorage[occupied[i]];
+        if (!def->nextOccupants) {
+            def->occupants = 0;
+            trigger_exit(def);
+        }
+    }
+
+    // 3. Vazios antes e ocupados agora -> enter
+    for (u16 i = 0; i < touchedCount; i++) {
+        TriggerDef* def = &triggerDefStorage[touched[i]];
+        if (!def->occupants) trigger_enter(def);
+        def->occupants = def->nextOccupants;
+        def->nextOccupants = 0;
+        occupied[i] = touched[i];
+    }
+    occupiedCount = touchedCount;
+}
+
+void trigger_draw(Entity* self) {
     Vect2D_s16 pos = entity_getGlobalPosition(self);
     AABB aabb; entity_getAABB(self, &aabb);
 
     bool visible = should_update(&pos, &aabb, self->drawPolicy);
-    entity_setVisible(self, visible);
-    if (visible){
+    if (!visible) entity_setVisible(self, FALSE);
+    else if (self->anim.sprite) {
         s16 screenX = pos.x - camera_getPosition().x;
         s16 screenY = pos.y - camera_getPosition().y;
-        SPR_setPosition(self->anim.sprite, screenX, screenY);    
+        animcontroller_setPosition(&self->anim, screenX, screenY);
+        spriteMux_submit(self, screenY, FALSE);
     }    
-
-    if (!zone || !zone->sprite || !zone->active) return;
-
-    s16 dx = zone->hitbox.x - camera_getPosition().x;
-    s16 dy = zone->hitbox.y - camera_getPosition().y;
-
-    if (dx + zone->hitbox.w >= 0 && dx <= 320 &&
-        dy + zone->hitbox.h >= 0 && dy <= 224) {
-        blocking_setVisible(zone, TRUE);        
-    }
-    else {
-        blocking_setVisible(zone, FALSE);
-    }   
-
-    if(zone->visible) {
-        SPR_setPosition(zone->sprite, dx, dy);
-    }
 }
 
 void trigger_applyZoneAction_wrapper(void* ctx) {
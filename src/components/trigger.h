@@ -7,8 +7,15 @@
 #include "components/trigger_def.h"
 #include "components/blocking_zone.h"
 
-Entity* entity_spawnTrigger(u16 index, Vect2D_u16 position, TriggerType triggerType, TriggerZoneAction zoneAction, TriggerCallback onEnter, TriggerCallback onExit, SpriteDefinition* spriteDef, BlockingZone* zone);
-void trigger_setTarget(Entity* player);
+// Monta o TriggerDef numa entidade já criada e carimba o volume na grade (ver prefab_trigger)
+// Sprite e paleta ficam com o prefab; a zona (opcional) vive com a fase, não com o trigger
+bool trigger_attach(Entity* e, Box hitbox, TriggerType triggerType, TriggerZoneAction zoneAction, TriggerCallback onEnter, TriggerCallback onExit, BlockingZone* zone);
+void trigger_init();
+// Testa os corpos com LAYER_TRIGGER na máscara contra a grade e gera enter/exit
+// Chamar depois de physics_updateAll() e antes de eventBus_dispatch()
+void trigger_updateAll();
 void trigger_applyZoneAction_wrapper(void* ctx);
+// Solta as zonas de todos os triggers (blocking_clearAll recicla o pool de zonas)
+void trigger_releaseZones();
 
 #endif
@@ -4,6 +4,7 @@
 #include "xtypes.h"
 #include "sprite.h"
 #include "components/blocking_zone.h"
+#include "core/handle.h"
 
 typedef enum {
     TRIGGER_TYPE_ONCE = 0,
@@ -29,6 +30,9 @@ typedef struct {
     TriggerCallback onExit;
     void* context;
     TriggerZoneAction zoneAction;
+    EntityHandle owner;     // Entidade do trigger (recebe os eventos)
+    u16 occupants;          // Bitset dos corpos (índice no pool) dentro do volume
+    u16 nextOccupants;      // Montado durante trigger_updateAll
 } TriggerDef;
 
 #endif
\ No newline at end of file
@@ -1,46 +1,128 @@
 #include "anim_controller.h"
 #include "components/entity_def.h"
+#include "core/event_bus.h"
 
 void anim_update(AnimController* anim, RigidBody* body);
 
+static bool spritesDirty = TRUE;  // Algo mudou desde o último SPR_update
+
+// Eixo vertical derivado da velocidade (não escreve no corpo)
+enum { VMOTION_GROUND, VMOTION_RISE, VMOTION_FALL, VMOTION_COUNT };
+// Eixo horizontal
+enum { HMOTION_IDLE, HMOTION_MOVE, HMOTION_COUNT };
+
+#define ANIM_ROW_ACTION(slot)   { slot, slot, slot, slot, slot, slot }
+#define ANIM_ROW_FREE           { ANIM_SLOT_IDLE, ANIM_SLOT_RUN, ANIM_SLOT_JUMP, ANIM_SLOT_JUMP, ANIM_SLOT_FALL, ANIM_SLOT_FALL }
+
+/**
+ * Estado empacotado (ação, vertical, movimento) -> AnimSlot
+ * Prioridade: ação > estado vertical > movimento. Ações sem animação própria
+ * (casting, interacting) usam a linha livre.
+ */
+static const u8 animSlotTable[ASTATE_CLIMBING + 1][VMOTION_COUNT * HMOTION_COUNT] = {
+    [ASTATE_NONE]        = ANIM_ROW_FREE,
+    [ASTATE_ATTACKING]   = ANIM_ROW_ACTION(ANIM_SLOT_ATTACK),
+    [ASTATE_CASTING]     = ANIM_ROW_FREE,
+    [ASTATE_INTERACTING] = ANIM_ROW_FREE,
+    [ASTATE_HURT]        = ANIM_ROW_ACTION(ANIM_SLOT_HURT),
+    [ASTATE_CLIMBING]    = ANIM_ROW_ACTION(ANIM_SLOT_CLIMB),
+};
+
+static const AnimEventTable* findEventTable(const Sprite* sprite) {
+    if (!sprite) return NULL;
+    for (u16 i = 0; i < animEventTableCount; i++) {
+        if (animEventTables[i].sprite == sprite->definition) return &animEventTables[i];
+    }
+    return NULL;
+}
+
 void animcontroller_init(AnimController *ac, Sprite *sprite, const AnimStateSet *animSet) {
     ac->sprite = sprite;
     ac->animSet = animSet;
     ac->currentAnim = 0xFFFF; // Nenhuma animação ativa no início
+    ac->events = findEventTable(sprite);
+    ac->lastAnim = -1;
+    ac->lastFrame = -1;
 }
 
 void animcontroller_update(AnimController* anim, struct RigidBody* body){
-    u16 an = anim->animSet->idle; // Padrão: idle
     fix16 vx = body->velocity.x;
     fix16 vy = body->velocity.fixY;
 
-    if(vy < 0)
-        body->vState = VSTATE_FALLING;
-    else if(vy > 0)
-        body->vState = VSTATE_JUMPING;
-    else
-        body->vState = VSTATE_GROUNDED;
-
-    if (vx > 0) {
-        body->mState = MSTATE_RUNNING;
-        SPR_setHFlip(anim->sprite, FALSE); // virado para direita
-    } else if (vx < 0) {
-        body->mState = MSTATE_RUNNING;
-        SPR_setHFlip(anim->sprite, TRUE);  // virado para esquerda
-    }else
-        body->mState = MSTATE_IDLE;
-
-    // Prioridade: ação > estado vertical > movimento
-    if (body->aState == ASTATE_ATTACKING)      an = anim->animSet->attack;
-    else if (body->aState == ASTATE_HURT)      an = anim->animSet->hurt;
-    else if (body->aState == ASTATE_CLIMBING)  an = anim->animSet->climb;
-    else if (body->vState == VSTATE_JUMPING)   an = anim->animSet->jump;
-    else if (body->vState == VSTATE_FALLING)   an = anim->animSet->fall;
-    else if (body->mState == MSTATE_RUNNING)   an = anim->animSet->run;
-    else if (body->mState == MSTATE_WALKING)   an = anim->animSet->walk;
+    // Mesmo mapeamento do if-chain antigo, só que sem escrever vState no corpo:
+    // vy == 0 é chão, vy < 0 mostra a queda e vy > 0 o pulo
+    u16 vertical = (vy == 0) ? VMOTION_GROUND
+                 : (vy < 0) ? VMOTION_FALL : VMOTION_RISE;
+    u16 horizontal = vx ? HMOTION_MOVE : HMOTION_IDLE;
+
+    if (vx > 0)
+        animcontroller_setHFlip(anim, FALSE); // virado para direita
+    else if (vx < 0)
+        animcontroller_setHFlip(anim, TRUE);  // virado para esquerda
+
+    u16 action = (body->aState <= ASTATE_CLIMBING) ? body->aState : ASTATE_NONE;
+    u16 an = anim->animSet->slot[animSlotTable[action][vertical * HMOTION_COUNT + horizontal]];
 
     if (an != anim->currentAnim) {
         anim->currentAnim = an;
         SPR_setAnim(anim->sprite, an);
+        spritesDirty = TRUE;
+    }
+}
+
+void animcontroller_checkFrameEvents(Entity* e) {
+    AnimController* ac = &e->anim;
+    const AnimEventTable* table = ac->events;
+    if (!table || !ac->sprite) return;
+
+    s16 animInd = ac->sprite->animInd;
+    s16 frameInd = ac->sprite->frameInd;
+    if (animInd == ac->lastAnim && frameInd == ac->lastFrame) return;
+    ac->lastAnim = animInd;
+    ac->lastFrame = frameInd;
+
+    for (u16 i = 0; i < table->count; i++) {
+        const AnimFrameEvent* ev = &table->events[i];
+        if (ev->anim > animInd) break;   // tabela ordenada
+        if (ev->anim == animInd && ev->frame == frameInd)
+            eventBus_push(e, (EntityEventType)ev->type);
     }
+}
+
+void animcontroller_setPosition(AnimController* ac, s16 x, s16 y) {
+    if (ac->posSynced && ac->screenX == x && ac->screenY == y) return;
+    ac->screenX = x;
+    ac->screenY = y;
+    ac->posSynced = TRUE;
+    SPR_setPosition(ac->sprite, x, y);
+    spritesDirty = TRUE;
+}
+
+void animcontroller_setHFlip(AnimController* ac, bool flip) {
+    if (ac->hFlip == flip) return;
+    ac->hFlip = flip;
+    SPR_setHFlip(ac->sprite, flip);
+    spritesDirty = TRUE;
+}
+
+void animcontroller_setVisible(AnimController* ac, bool visible) {
+    if (ac->visible == visible) return;
+    ac->visible = visible;
+    SPR_setVisibility(ac->sprite, visible ? VISIBLE : HIDDEN);
+    spritesDirty = TRUE;
+}
+
+bool animcontroller_isAnimating(const AnimController* ac) {
+    const Sprite* s = ac->sprite;
+    return ac->visible && s && s->animation && s->animation->numFrame > 1;
+}
+
+void animcontroller_markDirty(void) {
+    spritesDirty = TRUE;
+}
+
+void animcontroller_updateSprites(void) {
+    if (!spritesDirty) return;
+    spritesDirty = FALSE;
+    SPR_update();
 }
\ No newline at end of file
@@ -9,32 +9,88 @@ struct Entity;
 struct PathAgent;
 struct RigidBody;
 
-// Conjunto de animações por estado
-typedef struct {
-    u16 idle;
-    u16 walk;
-    u16 run;
-    u16 jump;
-    u16 fall;
-    u16 attack;
-    u16 hurt;
-    u16 climb;
+// Posição de cada animação dentro do AnimStateSet
+typedef enum {
+    ANIM_SLOT_IDLE,
+    ANIM_SLOT_WALK,
+    ANIM_SLOT_RUN,
+    ANIM_SLOT_JUMP,
+    ANIM_SLOT_FALL,
+    ANIM_SLOT_ATTACK,
+    ANIM_SLOT_HURT,
+    ANIM_SLOT_CLIMB,
+    ANIM_SLOT_COUNT
+} AnimSlot;
+
+// Conjunto de animações por estado (acessível por nome ou por AnimSlot)
+typedef union {
+    struct {
+        u16 idle;
+        u16 walk;
+        u16 run;
+        u16 jump;
+        u16 fall;
+        u16 attack;
+        u16 hurt;
+        u16 climb;
+    };
+    u16 slot[ANIM_SLOT_COUNT];
 } AnimStateSet;
 
 extern const AnimStateSet defaultAnimSet;
 
+// Evento disparado quando a animação `anim` entra no quadro `frame`
+typedef struct {
+    u8 anim;
+    u8 frame;
+    u8 type;        // EntityEventType (ex: ENTITY_EVENT_ANIM_FOOTSTEP)
+} AnimFrameEvent;
+
+// Eventos de quadro de uma SpriteDefinition (ordenados por anim, frame)
+typedef struct {
+    const SpriteDefinition* sprite;
+    const AnimFrameEvent* events;
+    u16 count;
+} AnimEventTable;
+
+// Registro global (game_config.c), ao lado das definições de sprite
+extern const AnimEventTable animEventTables[];
+extern const u16 animEventTableCount;
+
 // Controlador de animação
+// Guarda o último valor escrito no sprite: as chamadas SPR_* só saem quando algo muda
 typedef struct {
     Sprite *sprite;
     bool visible;
+    bool hFlip;                 // Último flip escrito
+    bool posSynced;             // FALSE força a próxima escrita de posição
+    bool sharedVram;            // Sprite do core/sprite_cache (liberar com spriteCache_releaseSprite)
     const AnimStateSet *animSet;
     u16 currentAnim;
+    s16 screenX, screenY;       // Última posição escrita
+    const AnimEventTable* events; // NULL = sprite sem eventos de quadro
+    s16 lastAnim, lastFrame;      // Último quadro visto pelos eventos
 } AnimController;
 
 // Inicializa o controlador
 void animcontroller_init(AnimController *ac, Sprite *sprite, const AnimStateSet *animSet);
 
-// Atualiza a animação com base nos estados atuais
+// Escolhe a animação pelo estado do corpo (só lê o RigidBody)
 void animcontroller_update(AnimController* anim, struct RigidBody* body);
 
+// Dispara (via event bus) os eventos do quadro atual, se o quadro mudou
+void animcontroller_checkFrameEvents(struct Entity* e);
+
+// Escritas no sprite com cache: só chamam SPR_* (e sujam o frame) se o valor mudou
+void animcontroller_setPosition(AnimController* ac, s16 x, s16 y);
+void animcontroller_setHFlip(AnimController* ac, bool flip);
+void animcontroller_setVisible(AnimController* ac, bool visible);
+// Sprite com animação de vários quadros (precisa do SPR_update para andar)
+bool animcontroller_isAnimating(const AnimController* ac);
+
+// Para SPR_* chamados fora do controlador (criação, release, blocking zones...)
+void animcontroller_markDirty(void);
+// Substitui o SPR_update(): só roda se algum sprite mudou neste frame
+void animcontroller_updateSprites(void);
+
 #endif // ANIM_CONTROLLER_H
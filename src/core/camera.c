@@ -16,7 +16,7 @@ static struct {
     AABB expandedBounds;       // Expanded bounds for near camera updates
     s16 maxCameraX;
     s16 maxCameraY;
-    RigidBody* target;         // Current target to follow
+    BodyHandle target;         // Current target to follow (generational handle)
     fix16 parallaxX;           // Horizontal parallax factor
     fix16 parallaxY;           // Vertical parallax factor
     bool parallaxEnabled;      // Whether parallax is enabled
@@ -32,7 +32,7 @@ static Map* mapFG = NULL;  // Foreground map
 static Map* mapBG = NULL;  // Background map
 
 void camera_init(RigidBody* targetOrNull, Vect2D_u16 deadzoneSize) {
-    camera.target = targetOrNull;
+    camera.target = rigidbody_getHandle(targetOrNull);
     camera.levelSize = newVector2D_u16(tiledMap_getWidth() << 4, tiledMap_getHeight() << 4);
 
     // Calculate deadzone bounds centered on screen
@@ -55,7 +55,7 @@ void camera_init(RigidBody* targetOrNull, Vect2D_u16 deadzoneSize) {
 }
 
 void camera_setTarget(RigidBody* target) {
-    camera.target = target;
+    camera.target = rigidbody_getHandle(target);
 }
 
 void camera_setMode(CameraMode mode) {
@@ -84,6 +84,9 @@ void camera_update() {
     camera.expandedBounds.max.x = camera.screenBounds.max.x + CAMERA_EXPANDED_BOUNDS;
     camera.expandedBounds.min.y = camera.screenBounds.min.y - CAMERA_EXPANDED_BOUNDS;
     camera.expandedBounds.max.y = camera.screenBounds.max.y + CAMERA_EXPANDED_BOUNDS;
+
+    // Alvo reciclado resolve para NULL e a câmera simplesmente para de seguir
+    RigidBody* target = rigidbody_resolve(camera.target);
     
     if (camera.autoScrolling) {
         s16 oldX = camera.position.x;
@@ -102,7 +105,7 @@ void camera_update() {
         );
         
         // If in drag mode and we have a target, handle player position
-        if (camera.mode == CAMERA_MODE_DRAG_PLAYER && camera.target != NULL) {
+        if (camera.mode == CAMERA_MODE_DRAG_PLAYER && target != NULL) {
             s16 deltaX = camera.position.x - oldX;
             s16 deltaY = camera.position.y - oldY;
             
@@ -110,34 +113,34 @@ void camera_update() {
             if (!camera.allowPlayerMovement) {
                                 
                 // Get player bounds
-                s16 playerLeft = camera.target->globalPosition.x - camera.target->centerOffset.x;
-                s16 playerRight = playerLeft + (camera.target->aabb.max.x - camera.target->aabb.min.x);
-                s16 playerTop = camera.target->globalPosition.y - camera.target->centerOffset.y;
-                s16 playerBottom = playerTop + (camera.target->aabb.max.y - camera.target->aabb.min.y);
+                s16 playerLeft = target->globalPosition.x - target->centerOffset.x;
+                s16 playerRight = playerLeft + (target->aabb.max.x - target->aabb.min.x);
+                s16 playerTop = target->globalPosition.y - target->centerOffset.y;
+                s16 playerBottom = playerTop + (target->aabb.max.y - target->aabb.min.y);
                 
                 // Correct player position if outside screen bounds
                 if (playerLeft < camera.screenBounds.min.x) {
-                    camera.target->globalPosition.x = camera.screenBounds.min.x + camera.target->centerOffset.x;
+                    target->globalPosition.x = camera.screenBounds.min.x + target->centerOffset.x;
                 } else if (playerRight > camera.screenBounds.max.x) {
-                    camera.target->globalPosition.x = camera.screenBounds.max.x - (camera.target->aabb.max.x - camera.target->aabb.min.x) + camera.target->centerOffset.x;
+                    target->globalPosition.x = camera.screenBounds.max.x - (target->aabb.max.x - target->aabb.min.x) + target->centerOffset.x;
                 }
                 
                 if (playerTop < camera.screenBounds.min.y) {
-                    camera.target->globalPosition.y = camera.screenBounds.min.y + camera.target->centerOffset.y;
+                    target->globalPosition.y = camera.screenBounds.min.y + target->centerOffset.y;
                 } else if (playerBottom > camera.screenBounds.max.y) {
-                    camera.target->globalPosition.y = camera.screenBounds.max.y - (camera.target->aabb.max.y - camera.target->aabb.min.y) + camera.target->centerOffset.y;
+                    target->globalPosition.y = camera.screenBounds.max.y - (target->aabb.max.y - target->aabb.min.y) + target->centerOffset.y;
                 }
             }
             
             // Apply camera movement to player
-            camera.target->globalPosition.x += deltaX;
-            camera.target->globalPosition.y += deltaY;
+            target->globalPosition.x += deltaX;
+            target->globalPosition.y += deltaY;
         }
-    } else if (camera.target != NULL) {
+    } else if (target != NULL) {
         // Calculate target center position
         Vect2D_s16 center = {
-            camera.target->globalPosition.x + camera.target->centerOffset.x,
-            camera.target->globalPosition.y + camera.target->centerOffset.y
+            target->globalPosition.x + target->centerOffset.x,
+            target->globalPosition.y + target->centerOffset.y
         };
 
         // Update camera position to follow target within deadzone
@@ -0,0 +1,95 @@
+/**
+ * @file event_bus.c
+ * @brief Fila de eventos de gameplay entregue uma vez por frame
+ *
+ * Física e triggers só gravam registros na fila; os callbacks (código frio)
+ * rodam todos juntos em eventBus_dispatch(), fora dos loops quentes e numa
+ * ordem fixa: por tipo e, dentro do tipo, pelo índice do receptor. A ordem
+ * de chegada (que muda com a ordem dos slots, do grid e dos corpos) só
+ * desempata eventos iguais para o mesmo receptor.
+ */
+
+#include "event_bus.h"
+#include "core/game_config.h"
+#include "core/logger.h"
+#include "components/entity.h"
+
+// order[]/start[] guardam índices da fila e contagens em u8
+#if MAX_EVENTS > 255
+#error "MAX_EVENTS > 255: eventBus_dispatch ordena com indices u8"
+#endif
+
+static GameEvent queue[MAX_EVENTS];
+static u16 queueCount;
+static u16 lastCount;
+static u16 dropped;
+
+void eventBus_init(void) {
+    queueCount = 0;
+    lastCount = 0;
+    dropped = 0;
+}
+
+void eventBus_push(Entity* receiver, EntityEventType type) {
+    if (!receiver || !receiver->onEvent) return;   // ninguém para ouvir
+    if (queueCount >= MAX_EVENTS) {
+        dropped++;
+        return;
+    }
+    queue[queueCount].receiver = entity_getHandle(receiver);
+    queue[queueCount].type = type;
+    queueCount++;
+}
+
+void eventBus_dispatch(void) {
+    u16 count = queueCount;
+    if (!count) {
+        lastCount = 0;
+        return;
+    }
+
+    // Radix (LSD) com dois counting sorts estáveis: receptor, depois tipo
+    u8 byReceiver[MAX_EVENTS];
+    u8 order[MAX_EVENTS];
+    {
+        u8 start[MAX_ENTITIES + 1];
+        memset(start, 0, sizeof(start));
+        for (u16 i = 0; i < count; i++) start[handle_index(queue[i].receiver) + 1]++;
+        for (u16 r = 0; r < MAX_ENTITIES; r++) start[r + 1] += start[r];
+        for (u16 i = 0; i < count; i++) byReceiver[start[handle_index(queue[i].receiver)]++] = i;
+    }
+    {
+        u8 start[ENTITY_EVENT_COUNT + 1];
+        memset(start, 0, sizeof(start));
+        for (u16 i = 0; i < count; i++) start[queue[i].type + 1]++;
+        for (u16 t = 0; t < ENTITY_EVENT_COUNT; t++) start[t + 1] += start[t];
+        for (u16 i = 0; i < count; i++) {
+            const u8 q = byReceiver[i];
+            order[start[queue[q].type]++] = q;
+        }
+    }
+
+    for (u16 i = 0; i < count; i++) {
+        const GameEvent* ev = &queue[order[i]];
+        Entity* e = entity_resolve(ev->receiver);
+        if (e && e->onEvent) e->onEvent(e, (EntityEventType)ev->type);
+    }
+
+    // Eventos empurrados pelos próprios handlers vão para o início
+    queueCount -= count;
+    for (u16 i = 0; i < queueCount; i++) queue[i] = queue[count + i];
+
+    if (dropped) {
+        debug_log("EventBus: %d eventos descartados (MAX_EVENTS %d)", dropped, MAX_EVENTS);
+        dropped = 0;
+    }
+    lastCount = count;
+}
+
+u16 eventBus_lastCount(void) {
+    return lastCount;
+}
+
+u16 eventBus_droppedCount(void) {
+    return dropped;
+}
@@ -0,0 +1,36 @@
+#ifndef EVENT_BUS_H
+#define EVENT_BUS_H
+
+#include <genesis.h>
+#include "components/entity_def.h"
+
+/**
+ * Registro compacto de evento (4 bytes): quem recebe e o quê.
+ * O receptor é um handle, então eventos de entidades destruídas antes da
+ * entrega são descartados sem risco.
+ */
+typedef struct {
+    EntityHandle receiver;
+    u16 type;          // EntityEventType
+} GameEvent;
+
+void eventBus_init(void);
+
+/**
+ * @brief Enfileira um evento para `receiver->onEvent` (entregue no próximo dispatch)
+ * Seguro para chamar de dentro de loops quentes (física, triggers): só grava 4 bytes.
+ */
+void eventBus_push(Entity* receiver, EntityEventType type);
+
+/**
+ * @brief Entrega os eventos enfileirados, agrupados por tipo e, no tipo, por receptor
+ * Chamar uma vez por frame, depois de physics_updateAll().
+ * Eventos gerados durante a entrega ficam para o próximo frame.
+ */
+void eventBus_dispatch(void);
+
+// Estatísticas do último dispatch / descartes por fila cheia
+u16 eventBus_lastCount(void);
+u16 eventBus_droppedCount(void);
+
+#endif // EVENT_BUS_H
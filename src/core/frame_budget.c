@@ -0,0 +1,84 @@
+/**
+ * @file frame_budget.c
+ * @brief Agendador de tarefas adiáveis limitado pelo contador V do VDP
+ *
+ * O contador V diz em qual scanline o feixe está. Enquanto ele estiver antes
+ * de FRAME_BUDGET_END_LINE ainda sobra tempo de CPU no frame e dá para rodar
+ * trabalho opcional (IA, pathfinding, descompressão...) sem atrasar o VBlank.
+ * As tarefas ficam ordenadas por prioridade e são chamadas em fatias; a cada
+ * fatia o contador é lido de novo.
+ */
+
+#include "frame_budget.h"
+#include "core/game_config.h"
+#include "core/logger.h"
+
+typedef struct {
+    FrameTaskFunc func;
+    void* data;
+    u8 priority;
+} FrameTask;
+
+static FrameTask tasks[MAX_FRAME_TASKS];   // Ordenadas por prioridade (maior primeiro)
+static u16 taskCount;
+static u16 frameStartLine;                 // Linha em que frameBudget_run começou
+
+void frameBudget_init(void) {
+    taskCount = 0;
+}
+
+bool frameBudget_add(FrameTaskFunc func, void* data, u8 priority) {
+    if (!func) return FALSE;
+    if (taskCount >= MAX_FRAME_TASKS) {
+        debug_log("FrameBudget: fila cheia (%d)", MAX_FRAME_TASKS);
+        return FALSE;
+    }
+
+    // Inserção ordenada; mesma prioridade mantém a ordem de chegada
+    u16 i = taskCount;
+    while (i > 0 && tasks[i - 1].priority < priority) {
+        tasks[i] = tasks[i - 1];
+        i--;
+    }
+    tasks[i].func = func;
+    tasks[i].data = data;
+    tasks[i].priority = priority;
+    taskCount++;
+    return TRUE;
+}
+
+static void removeAt(u16 index) {
+    taskCount--;
+    for (u16 i = index; i < taskCount; i++) tasks[i] = tasks[i + 1];
+}
+
+void frameBudget_cancel(FrameTaskFunc func, void* data) {
+    for (u16 i = 0; i < taskCount; i++) {
+        if (tasks[i].func == func && tasks[i].data == data) {
+            removeAt(i);
+            return;
+        }
+    }
+}
+
+u16 frameBudget_linesLeft(void) {
+    u16 line = GET_VCOUNTER;
+    // Já no VBlank, ou o contador deu a volta (frame estourado): sem orçamento
+    if (line < frameStartLine || line >= FRAME_BUDGET_END_LINE) return 0;
+    return FRAME_BUDGET_END_LINE - line;
+}
+
+void frameBudget_run(void) {
+    frameStartLine = GET_VCOUNTER;
+
+    u16 i = 0;
+    while (i < taskCount) {
+        if (!frameBudget_linesLeft()) return;
+
+        if (tasks[i].func(tasks[i].data)) {
+            // Ainda tem trabalho: continua na mesma tarefa enquanto houver orçamento
+            continue;
+        }
+        removeAt(i);
+    }
+}
@@ -0,0 +1,38 @@
+#ifndef FRAME_BUDGET_H
+#define FRAME_BUDGET_H
+
+#include <genesis.h>
+
+/**
+ * Fatia de uma tarefa adiável: faz um pedaço pequeno do trabalho e retorna
+ * TRUE se ainda há trabalho (volta no próximo frame/fatia) ou FALSE se terminou.
+ */
+typedef bool (*FrameTaskFunc)(void* data);
+
+// Prioridades sugeridas (maior roda primeiro)
+#define FRAME_TASK_PRIORITY_LOW     0
+#define FRAME_TASK_PRIORITY_NORMAL  64
+#define FRAME_TASK_PRIORITY_HIGH    128
+
+void frameBudget_init(void);
+
+/**
+ * @brief Registra uma tarefa adiável
+ * @return FALSE se a fila (MAX_FRAME_TASKS) estiver cheia
+ */
+bool frameBudget_add(FrameTaskFunc func, void* data, u8 priority);
+
+// Remove uma tarefa registrada (ex: dono destruído)
+void frameBudget_cancel(FrameTaskFunc func, void* data);
+
+/**
+ * @brief Roda fatias das tarefas, por prioridade, enquanto o feixe não passar
+ * de FRAME_BUDGET_END_LINE. O que sobrar continua no próximo frame.
+ * Chamar uma vez por frame, logo antes do SPR_update().
+ */
+void frameBudget_run(void);
+
+// Scanlines que ainda restam no orçamento deste frame (0 = acabou)
+u16 frameBudget_linesLeft(void);
+
+#endif // FRAME_BUDGET_H
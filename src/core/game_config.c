@@ -1,6 +1,8 @@
 #include "game_config.h"
 #include <maths.h>
 #include "core/anim_controller.h"
+#include "components/entity_def.h"
+#include "sprite.h"
 
 // Já inicializa com valores padrão diretamente
 EntityPhysicsParams defaultPhysicsParams = {
@@ -21,4 +23,19 @@ const AnimStateSet defaultAnimSet = {
     .attack = 5,
     .hurt   = 6,
     .climb  = 7
-};
\ No newline at end of file
+};
+
+/* Eventos de quadro por SpriteDefinition (o SPRITE do sprite.res não carrega
+ * dados extras, então a tabela fica aqui). Ordenar por anim e depois frame.
+ * Conferir os quadros sempre que a sheet mudar.
+ * player_sheet: 3 linhas de 8 quadros (0 parado, 1 andar/correr, 2 pulo).
+ */
+static const AnimFrameEvent playerSheetEvents[] = {
+    { .anim = 1, .frame = 3, .type = ENTITY_EVENT_ANIM_FOOTSTEP },   // andar: passada mais aberta, pé no chão
+    { .anim = 1, .frame = 7, .type = ENTITY_EVENT_ANIM_FOOTSTEP },   // andar: o outro pé
+};
+
+const AnimEventTable animEventTables[] = {
+    { .sprite = &player_sheet, .events = playerSheetEvents, .count = sizeof(playerSheetEvents) / sizeof(playerSheetEvents[0]) },
+};
+const u16 animEventTableCount = sizeof(animEventTables) / sizeof(animEventTables[0]);
@@ -55,6 +55,47 @@ typedef enum ActionState {
 #define MAX_ENTITIES 32
 #define MAX_BODIES   16
 #define ONE_WAY_PLATFORM_ERROR_CORRECTION 5  // Tolerância para colisão com plataforma
-#define MAX_BLOCKING_ZONES 4
+#define MAX_SPAWN_POINTS  128 // Objetos da fase controlados pelo spawner (ROM)
+// Pools de pData (slab) por tipo de entidade
+#define MAX_TRIGGERS        8
+#define MAX_ITEMS           16
+#define MAX_NPCS            8
+#define MAX_PATH_FOLLOWERS  8
+// Ao criar um follower LOOP, simula uma volta e loga se o corpo não voltar
+// ao ponto de saída (components/path_follower.c). Desligar na versão final.
+#ifndef PATH_CHECK_LOOP
+#define PATH_CHECK_LOOP     1
+#endif
+// Zonas de bloqueio (components/blocking_zone.h): vivem a fase inteira.
+// Limite só de memória: nenhuma zona é testada por frame
+#define MAX_BLOCKING_ZONES     8
+#define BLOCKING_BACKUP_TILES  256 // Arena dividida pelo backup de todas as zonas da fase
+// Agendador de tarefas adiáveis (core/frame_budget.h)
+#define MAX_FRAME_TASKS     8
+#define MAX_EVENTS          32 // Fila do event bus (core/event_bus.h)
+// Limites de sprite da VDP em H40 (core/sprite_mux.h)
+#define SPRITE_LINE_LIMIT   20
+#define SPRITE_TOTAL_LIMIT  80
+#define SPRITE_BAND_HEIGHT  16 // Altura (px) de cada faixa contada pelo multiplexador
+// Tiles compartilhados de sprite (core/sprite_cache.h)
+#define MAX_SPRITE_RESOURCES    8   // Definições diferentes carregadas ao mesmo tempo
+#define SPRITE_CACHE_VRAM_TILES 256 // Tamanho da região de VRAM do cache
+// Índice de interagíveis (components/interact.c)
+#define MAX_INTERACTABLES        32 // Estáticos: itens, NPCs, placas
+#define MAX_MOVING_INTERACTABLES 8  // Com corpo em movimento, testados sempre
+// Grade de ocupação dos triggers (components/trigger.c)
+#define TRIGGER_CELL_SHIFT      6   // Células de 64px
+#define TRIGGER_GRID_BUCKETS    64  // Potência de 2
+#define TRIGGER_GRID_ENTRIES    128 // Pares (célula, trigger) carimbados
+// Diálogo no plano WINDOW a partir desta linha de tiles (0 = desenha no BG_B)
+#define DIALOGUE_WINDOW_ROW     21
+// Fonte do diálogo da fase: SUBSET carrega só os glifos do banco da cena
+// (<BANCO>_GLYPHS tiles), VWF usa a fonte proporcional (DIALOGUE_VWF_VRAM_TILES)
+#define DIALOGUE_FONT_SUBSET    0
+#define DIALOGUE_FONT_VWF       1
+#ifndef DIALOGUE_FONT_MODE
+#define DIALOGUE_FONT_MODE      DIALOGUE_FONT_SUBSET
+#endif
+#define FRAME_BUDGET_END_LINE 200 // Última scanline útil: o resto fica para SPR_update + margem
 
 #endif
@@ -0,0 +1,36 @@
+#ifndef HANDLE_H
+#define HANDLE_H
+
+#include "types.h"
+
+/**
+ * @brief Handle geracional de 16 bits para slots de pool (Entity, RigidBody...)
+ *
+ * Layout: [ geração (10 bits) | índice (6 bits) ]
+ *
+ * Cada slot guarda sua geração atual, incrementada a cada destroy. Um handle
+ * antigo para um slot reciclado não bate mais com a geração e resolve para NULL,
+ * então os pools podem reutilizar slots sem medo de ponteiros "apelidados".
+ * A geração 0 nunca é usada, assim HANDLE_NULL (0) é sempre inválido.
+ */
+typedef u16 Handle;
+typedef Handle EntityHandle;
+typedef Handle BodyHandle;
+
+#define HANDLE_NULL         0
+#define HANDLE_INDEX_BITS   6
+#define HANDLE_INDEX_MASK   ((1 << HANDLE_INDEX_BITS) - 1)
+#define HANDLE_GEN_MASK     (0xFFFF >> HANDLE_INDEX_BITS)
+#define HANDLE_MAX_SLOTS    (1 << HANDLE_INDEX_BITS)
+
+#define handle_make(index, gen)   ((Handle)(((gen) << HANDLE_INDEX_BITS) | ((index) & HANDLE_INDEX_MASK)))
+#define handle_index(h)           ((u16)((h) & HANDLE_INDEX_MASK))
+#define handle_generation(h)      ((u16)((h) >> HANDLE_INDEX_BITS))
+
+// Próxima geração de um slot (pula o 0 reservado para HANDLE_NULL)
+static inline u16 handle_nextGeneration(u16 gen) {
+    gen = (gen + 1) & HANDLE_GEN_MASK;
+    return gen ? gen : 1;
+}
+
+#endif // HANDLE_H
@@ -0,0 +1,76 @@
+/**
+ * @file prefab.c
+ * @brief Criação de entidades dirigida por tabela (PrefabDef)
+ *
+ * Faz a parte comum a todo objeto da fase: entidade, corpo, sprite, paleta,
+ * flags e callbacks. O que é específico do tipo fica no init do prefab.
+ */
+
+#include "prefab.h"
+#include "core/logger.h"
+#include "components/entity.h"
+#include "components/rigidbody.h"
+#include "components/interact.h"
+#include "physics/physic_def.h"
+#include "core/sprite_cache.h"
+
+Entity* prefab_spawn(const PrefabDef* prefab, s16 x, s16 y, u16 param) {
+    if (!prefab) return NULL;
+
+    Entity* e = entity_create(prefab->logicPolicy, prefab->drawPolicy);
+    if (!e) return NULL;
+
+    if (prefab->hasBody) {
+        RigidBody* body = rigidbody_create(prefab->logicPolicy, prefab->layer, prefab->mask, prefab->tag);
+        if (!body) {
+            entity_destroy(e);
+            return NULL;
+        }
+        body->active = TRUE;
+        body->collidable = TRUE;
+        body->owner = entity_getHandle(e);
+        body->globalPosition.x = x + prefab->bodyOffset.x;
+        body->globalPosition.y = y + prefab->bodyOffset.y;
+        body->aabb = prefab->aabb;
+        e->body = body;
+    }
+
+    e->active = TRUE;
+    e->tipo = prefab->tipo;
+    e->flags = prefab->flags;
+    e->onUpdate = prefab->onUpdate;
+    e->onInteract = prefab->onInteract;
+    e->onEvent = prefab->onEvent;
+
+    e->anim.visible = TRUE;
+    e->anim.animSet = prefab->animSet;
+    if (prefab->sprite) {
+        // Instâncias do mesmo prefab dividem os tiles em VRAM
+        e->anim.sprite = spriteCache_addSprite(prefab->sprite, x, y, TILE_ATTR(prefab->palette, TRUE, FALSE, FALSE));
+        e->anim.sharedVram = TRUE;
+        spriteCache_loadPalette(prefab->palette, prefab->sprite);
+    }
+
+    if (prefab->init && !prefab->init(e, prefab, x, y, param)) {
+        debug_log("Prefab: init falhou (tipo %d, param %d)", prefab->tipo, param);
+        entity_destroy(e);
+        return NULL;
+    }
+    // Só depois do init: antes disso não há pData para o onDestroy liberar
+    // (NULL mantém o que o init instalou)
+    if (prefab->onDestroy) e->onDestroy = prefab->onDestroy;
+
+    if (e->body) {
+        RigidBody* body = e->body;
+        body->centerOffset = newVector2D_u16((body->aabb.min.x + body->aabb.max.x) / 2,
+                                             (body->aabb.min.y + body->aabb.max.y) / 2);
+    }
+
+    if (e->flags & FLAG_INTERACTABLE)
+        interact_register(e, e->body && prefab->logicPolicy != UPDATE_DISABLED);
+
+    if (prefab->animSet && e->anim.sprite)
+        animcontroller_init(&e->anim, e->anim.sprite, prefab->animSet);
+
+    return e;
+}
@@ -0,0 +1,18 @@
+#ifndef PREFAB_H
+#define PREFAB_H
+
+#include <genesis.h>
+#include "core/prefab_def.h"
+
+/**
+ * @brief Cria uma entidade a partir de um prefab
+ *
+ * @param prefab Descritor do tipo
+ * @param x Posição do spawn no mundo (px)
+ * @param y Posição do spawn no mundo (px)
+ * @param param Parâmetro da instância repassado ao init do prefab
+ * @return Entidade criada ou NULL (pool cheio / init falhou)
+ */
+Entity* prefab_spawn(const PrefabDef* prefab, s16 x, s16 y, u16 param);
+
+#endif // PREFAB_H
@@ -0,0 +1,53 @@
+#ifndef PREFAB_DEF_H
+#define PREFAB_DEF_H
+
+#include <genesis.h>
+#include "components/entity_def.h"
+
+struct PrefabDef;
+
+/**
+ * Monta a parte específica do tipo (pData, path, hitbox da instância...)
+ * @param x, y Posição do spawn (a mesma do sprite)
+ * @param param Parâmetro da instância (ex: índice em platforms[])
+ * @return FALSE se não conseguiu (pool cheio) - a entidade é destruída
+ */
+typedef bool (*PrefabInitFunc)(Entity* e, const struct PrefabDef* prefab, s16 x, s16 y, u16 param);
+
+/**
+ * Descritor de spawn de um tipo de objeto (fica em ROM)
+ * Tudo o que antes era repetido em cada função spawn_* (sprite, paleta,
+ * flags, políticas, corpo, callbacks) vira dado; só o que é específico do
+ * tipo fica no `init`.
+ */
+typedef struct PrefabDef {
+    EntityType tipo;
+    u16 flags;                          // FLAG_*
+    UpdatePolicy logicPolicy;
+    UpdatePolicy drawPolicy;
+
+    // --- visual ---
+    const SpriteDefinition* sprite;     // NULL = sem sprite
+    u16 palette;                        // PAL0..PAL2 (PAL3 é do destaque do diálogo)
+    const AnimStateSet* animSet;        // NULL = sem AnimController
+
+    // --- corpo (só se hasBody) ---
+    bool hasBody;
+    u8 layer;
+    u8 mask;
+    u16 tag;
+    AABB aabb;                          // hitbox padrão (o init pode trocar)
+    Vect2D_s16 bodyOffset;              // somado à posição do spawn
+
+    // --- callbacks ---
+    void (*onUpdate)(Entity*, u16 frames);
+    void (*onInteract)(Entity*);
+    void (*onDestroy)(Entity*);
+    void (*onEvent)(Entity* self, EntityEventType type);
+
+    PrefabInitFunc init;                // NULL = nada específico
+    u16 arg;                            // constante do prefab repassada ao init (ex: DistanceType)
+    const void* data;                   // dado extra em ROM para o init (ex: sprite da barreira do trigger)
+} PrefabDef;
+
+#endif // PREFAB_DEF_H
@@ -0,0 +1,56 @@
+#include "slab_pool.h"
+#include "core/logger.h"
+
+#define SLAB_ITEM(pool, i)  ((pool)->storage + (u32)(i) * (pool)->itemSize)
+#define SLAB_NEXT(pool, i)  (*(u16*)SLAB_ITEM(pool, i))
+
+void slab_init(SlabPool* pool, void* storage, u16 itemSize, u16 capacity) {
+    pool->storage = (u8*)storage;
+    pool->itemSize = itemSize;
+    pool->capacity = capacity;
+    pool->used = 0;
+
+    // Cada bloco precisa guardar o índice (u16) alinhado em word no 68000
+    if (itemSize < 2 || (itemSize & 1)) {
+        debug_log("Erro: Slab pool com bloco de %d bytes!", itemSize);
+        pool->capacity = 0;
+    }
+
+    if (pool->capacity == 0) {
+        pool->freeHead = SLAB_INVALID;
+        return;
+    }
+
+    for (u16 i = 0; i < capacity - 1; i++)
+        SLAB_NEXT(pool, i) = i + 1;
+    SLAB_NEXT(pool, capacity - 1) = SLAB_INVALID;
+
+    pool->freeHead = 0;
+}
+
+void* slab_alloc(SlabPool* pool) {
+    if (pool->freeHead == SLAB_INVALID) {
+        debug_log("Erro: Slab pool cheio! (%d blocos)", pool->capacity);
+        return NULL;
+    }
+
+    u16 index = pool->freeHead;
+    pool->freeHead = SLAB_NEXT(pool, index);
+    pool->used++;
+
+    return SLAB_ITEM(pool, index);
+}
+
+bool slab_owns(const SlabPool* pool, const void* item) {
+    const u8* p = (const u8*)item;
+    return p >= pool->storage && p < pool->storage + (u32)pool->capacity * pool->itemSize;
+}
+
+void slab_free(SlabPool* pool, void* item) {
+    if (!item || !slab_owns(pool, item)) return;
+
+    u16 index = (u16)(((u8*)item - pool->storage) / pool->itemSize);
+    SLAB_NEXT(pool, index) = pool->freeHead;
+    pool->freeHead = index;
+    pool->used--;
+}
@@ -0,0 +1,28 @@
+#ifndef SLAB_POOL_H
+#define SLAB_POOL_H
+
+#include <genesis.h>
+
+#define SLAB_INVALID 0xFFFF
+
+/**
+ * @brief Alocador de blocos de tamanho fixo (O(1) alloc/free)
+ *
+ * Os blocos livres guardam, nos seus 2 primeiros bytes, o índice do próximo
+ * livre, então não há memória extra além do próprio armazenamento.
+ * O armazenamento é estático (definido por quem usa), sem heap e sem fragmentação.
+ */
+typedef struct {
+    u8* storage;      // Área com capacity * itemSize bytes
+    u16 itemSize;     // Tamanho de cada bloco (par, >= 2)
+    u16 capacity;     // Quantidade de blocos
+    u16 freeHead;     // Primeiro bloco livre (SLAB_INVALID = cheio)
+    u16 used;         // Blocos em uso
+} SlabPool;
+
+void slab_init(SlabPool* pool, void* storage, u16 itemSize, u16 capacity);
+void* slab_alloc(SlabPool* pool);            // NULL se o pool estiver cheio
+void slab_free(SlabPool* pool, void* item);  // Ignora NULL e ponteiros de fora do pool
+bool slab_owns(const SlabPool* pool, const void* item);
+
+#endif // SLAB_POOL_H
@@ -0,0 +1,182 @@
+/**
+ * @file spawner.c
+ * @brief Streaming de objetos da fase pela janela da câmera
+ *
+ * Os objetos exportados do Tiled ficam em ROM numa lista ordenada por x.
+ * - Ativação: a cada movimento da câmera, busca binária acha a fatia de
+ *   pontos de spawn dentro da janela de ativação e cria os que faltam.
+ * - Despawn: todo frame, cada entidade viva é testada pela posição atual
+ *   (plataformas e NPCs andam para longe do ponto de origem) contra a
+ *   janela de despawn.
+ * Um bitset guarda os objetos consumidos (coletados/mortos) para que não
+ * voltem quando a câmera passar por eles de novo. Outro marca os que saíram
+ * da janela com o ponto de origem ainda na ativação: só renascem depois que
+ * o ponto sair da fatia, senão nasceriam e morreriam em sequência.
+ */
+
+#include "spawner.h"
+#include "core/camera.h"
+#include "core/game_config.h"
+#include "core/logger.h"
+#include "core/prefab.h"
+#include "components/entity.h"
+
+static const SpawnPoint* spawnPoints = NULL;
+static u16 spawnCount = 0;
+static const PrefabDef* const* prefabs = NULL;
+static u16 prefabCount = 0;
+
+static EntityHandle spawned[MAX_SPAWN_POINTS];          // Entidade viva de cada ponto (HANDLE_NULL = não criada)
+static u8 consumed[(MAX_SPAWN_POINTS + 7) >> 3];        // Bitset de persistência
+static u8 parked[(MAX_SPAWN_POINTS + 7) >> 3];          // Saiu da tela com o ponto ainda na ativação
+
+static u16 alive[MAX_ENTITIES];     // Pontos com entidade criada, testados todo frame
+static u16 aliveCount;
+
+static u16 rangeFirst, rangeLast;   // Fatia [first, last) dentro da janela de ativação no último update
+static Vect2D_s16 lastCamera;
+static bool dirty;
+
+/**
+ * @brief Primeiro índice com x >= value (lista ordenada por x)
+ */
+static u16 lowerBoundX(s16 value) {
+    u16 lo = 0, hi = spawnCount;
+    while (lo < hi) {
+        u16 mid = (lo + hi) >> 1;
+        if (spawnPoints[mid].x < value) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+#define bitTest(set, i)     ((set)[(i) >> 3] & (1 << ((i) & 7)))
+#define bitSet(set, i)      ((set)[(i) >> 3] |= (1 << ((i) & 7)))
+#define bitClear(set, i)    ((set)[(i) >> 3] &= ~(1 << ((i) & 7)))
+
+static void spawn(u16 id) {
+    const SpawnPoint* p = &spawnPoints[id];
+    if (p->kind >= prefabCount || !prefabs[p->kind]) return;
+    if (aliveCount >= MAX_ENTITIES) return;   // Entradas mortas saem no próximo update
+
+    Entity* e = prefab_spawn(prefabs[p->kind], p->x, p->y, p->index);
+    if (!e) {
+        debug_log("Spawner: falha ao criar objeto %d (pool cheio?)", id);
+        return;
+    }
+    e->spawnId = id;
+    spawned[id] = entity_getHandle(e);
+    alive[aliveCount++] = id;
+}
+
+void spawner_init(const SpawnPoint* points, u16 count, const PrefabDef* const* prefabTable, u16 prefabTableCount) {
+    if (count > MAX_SPAWN_POINTS) {
+        debug_log("Spawner: %d pontos, limite e' %d", count, MAX_SPAWN_POINTS);
+        count = MAX_SPAWN_POINTS;
+    }
+
+    spawnPoints = points;
+    spawnCount = count;
+    prefabs = prefabTable;
+    prefabCount = prefabTableCount;
+
+    // Tipo sem prefab no registro nunca nasce: avisa uma vez em vez de sumir calado
+    for (u16 i = 0; i < count; i++) {
+        const u8 kind = points[i].kind;
+        if (kind < prefabCount && prefabs[kind]) continue;
+        debug_log("Spawner: ponto %d (%d,%d) tipo %d sem prefab", i, points[i].x, points[i].y, kind);
+    }
+
+    for (u16 i = 0; i < MAX_SPAWN_POINTS; i++) spawned[i] = HANDLE_NULL;
+    memset(consumed, 0, sizeof(consumed));
+    memset(parked, 0, sizeof(parked));
+    aliveCount = 0;
+
+    rangeFirst = rangeLast = 0;
+    dirty = TRUE;
+}
+
+void spawner_update(void) {
+    if (!spawnPoints) return;
+
+    Vect2D_s16 cam = camera_getPosition();
+    const s16 actMinX = cam.x - SPAWN_ACTIVATE_MARGIN;
+    const s16 actMaxX = cam.x + SCREEN_WIDTH + SPAWN_ACTIVATE_MARGIN;
+    const s16 actMinY = cam.y - SPAWN_ACTIVATE_MARGIN;
+    const s16 actMaxY = cam.y + SCREEN_HEIGHT + SPAWN_ACTIVATE_MARGIN;
+    const s16 desMinX = cam.x - SPAWN_DESPAWN_MARGIN;
+    const s16 desMaxX = cam.x + SCREEN_WIDTH + SPAWN_DESPAWN_MARGIN;
+    const s16 desMinY = cam.y - SPAWN_DESPAWN_MARGIN;
+    const s16 desMaxY = cam.y + SCREEN_HEIGHT + SPAWN_DESPAWN_MARGIN;
+
+    // Despawn pela posição atual: a câmera parada não impede a entidade de sair
+    for (u16 k = 0; k < aliveCount; ) {
+        const u16 id = alive[k];
+        Entity* e = entity_resolve(spawned[id]);
+
+        if (e) {
+            // Destruída pela própria lógica do jogo resolve para NULL e só libera o ponto
+            Vect2D_s16 pos = entity_getGlobalPosition(e);
+            if (pos.x >= desMinX && pos.x <= desMaxX && pos.y >= desMinY && pos.y <= desMaxY) {
+                k++;
+                continue;
+            }
+            entity_destroy(e);
+
+            const SpawnPoint* p = &spawnPoints[id];
+            if (p->x >= actMinX && p->x <= actMaxX && p->y >= actMinY && p->y <= actMaxY)
+                bitSet(parked, id);
+        }
+        spawned[id] = HANDLE_NULL;
+        alive[k] = alive[--aliveCount];
+    }
+
+    if (!dirty && cam.x == lastCamera.x && cam.y == lastCamera.y) return;
+    lastCamera = cam;
+    dirty = FALSE;
+
+    const u16 first = lowerBoundX(actMinX);
+    const u16 last  = lowerBoundX(actMaxX + 1);
+
+    // Pontos que saíram da fatia de ativação podem renascer quando voltarem
+    for (u16 i = rangeFirst; i < rangeLast; i++) {
+        if (i < first || i >= last) bitClear(parked, i);
+    }
+    rangeFirst = first;
+    rangeLast = last;
+
+    for (u16 i = first; i < last; i++) {
+        if (spawned[i] != HANDLE_NULL) continue;
+
+        const SpawnPoint* p = &spawnPoints[i];
+        if (p->y < actMinY || p->y > actMaxY) {
+            bitClear(parked, i);
+            continue;
+        }
+        if (bitTest(consumed, i) || bitTest(parked, i)) continue;
+
+        spawn(i);
+    }
+}
+
+void spawner_markConsumed(Entity* e) {
+    if (!e || e->spawnId >= spawnCount) return;
+    bitSet(consumed, e->spawnId);
+}
+
+bool spawner_isConsumed(u16 spawnId) {
+    if (spawnId >= spawnCount) return FALSE;
+    return bitTest(consumed, spawnId) != 0;
+}
+
+void spawner_clear(void) {
+    for (u16 k = 0; k < aliveCount; k++) {
+        Entity* e = entity_resolve(spawned[alive[k]]);
+        if (e) entity_destroy(e);
+        spawned[alive[k]] = HANDLE_NULL;
+    }
+    aliveCount = 0;
+    memset(parked, 0, sizeof(parked));
+    rangeFirst = rangeLast = 0;
+    dirty = TRUE;
+}
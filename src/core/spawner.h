@@ -0,0 +1,42 @@
+#ifndef SPAWNER_H
+#define SPAWNER_H
+
+#include <genesis.h>
+#include "core/spawner_def.h"
+#include "core/prefab_def.h"
+#include "components/entity_def.h"
+
+// Margem além da tela onde objetos são criados
+#define SPAWN_ACTIVATE_MARGIN   32
+// Margem (maior) além da tela onde objetos são destruídos - histerese evita spawn/despawn em sequência
+#define SPAWN_DESPAWN_MARGIN    96
+
+/**
+ * @brief Inicia o streaming de objetos da fase
+ *
+ * @param points Lista de spawn ordenada por x (ROM)
+ * @param count Quantidade de pontos (máx. MAX_SPAWN_POINTS)
+ * @param prefabs Registro de prefabs indexado por SpawnPoint.kind (entradas NULL são ignoradas)
+ * @param prefabCount Tamanho da tabela prefabs
+ */
+void spawner_init(const SpawnPoint* points, u16 count, const PrefabDef* const* prefabs, u16 prefabCount);
+
+/**
+ * @brief Cria objetos cujo ponto de spawn entra na janela da câmera e destrói
+ * as entidades cuja posição atual sai da janela de despawn
+ * Deve ser chamado uma vez por frame, depois de camera_update()
+ */
+void spawner_update(void);
+
+/**
+ * @brief Marca o objeto de origem da entidade como consumido (coletado, morto...)
+ * Ele não volta a ser criado até o próximo spawner_init()
+ */
+void spawner_markConsumed(Entity* e);
+
+bool spawner_isConsumed(u16 spawnId);
+
+// Destrói tudo o que foi criado pelo spawner (mantém o bitset de persistência)
+void spawner_clear(void);
+
+#endif // SPAWNER_H
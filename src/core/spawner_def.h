@@ -0,0 +1,20 @@
+#ifndef SPAWNER_DEF_H
+#define SPAWNER_DEF_H
+
+#include "types.h"
+
+#define SPAWN_ID_NONE 0xFFFF
+
+/**
+ * Ponto de spawn exportado do Tiled (TMXObjectParserSplitOutput)
+ * Registro compacto prefab + parâmetro: `kind` escolhe o PrefabDef na tabela
+ * da fase e `index` é repassado ao init do prefab.
+ * A lista vem ordenada por x para o spawner poder fazer busca binária.
+ */
+typedef struct {
+    s16 x, y;     // posição do objeto no mundo (px)
+    u8 kind;      // ID do prefab = SpawnKind gerado junto com as tabelas (ex: SPAWN_KIND_PLATFORM)
+    u8 index;     // índice dentro da tabela ROM do tipo (ex: platforms[index])
+} SpawnPoint;
+
+#endif // SPAWNER_DEF_H
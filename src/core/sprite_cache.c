@@ -0,0 +1,133 @@
+/**
+ * @file sprite_cache.c
+ * @brief Tiles de sprite compartilhados entre instâncias da mesma definição
+ *
+ * Por padrão cada SPR_addSprite ganha sua própria cópia dos tiles em VRAM.
+ * Aqui os quadros de uma definição são carregados uma vez numa região de
+ * VRAM gerenciada à mão (VRAM_alloc) e todas as instâncias apontam para eles;
+ * a troca de quadro só muda o índice do tile (callback de frame change).
+ * Um contador de referências libera a VRAM quando a última instância sai.
+ */
+
+#include "sprite_cache.h"
+#include "core/game_config.h"
+#include "core/logger.h"
+
+typedef struct {
+    const SpriteDefinition* def;    // NULL = vaga livre
+    u16** frameTiles;               // [anim][frame] -> índice do tile (SPR_loadAllFrames)
+    u16 baseTile;
+    u16 refCount;
+} SpriteResource;
+
+static SpriteResource resources[MAX_SPRITE_RESOURCES];
+static VRAMRegion region;
+static bool regionReady = FALSE;
+
+// Última paleta enviada para cada linha de cor
+static const u16* loadedPalette[4];
+
+void spriteCache_init(u16 vramBase, u16 vramSize) {
+    for (u16 i = 0; i < MAX_SPRITE_RESOURCES; i++) {
+        if (resources[i].frameTiles) MEM_free(resources[i].frameTiles);
+        resources[i].def = NULL;
+        resources[i].frameTiles = NULL;
+        resources[i].refCount = 0;
+    }
+    if (regionReady) VRAM_releaseRegion(&region);
+    VRAM_createRegion(&region, vramBase, vramSize);
+    regionReady = TRUE;
+
+    spriteCache_resetPalettes();
+}
+
+static SpriteResource* findResource(const SpriteDefinition* def) {
+    for (u16 i = 0; i < MAX_SPRITE_RESOURCES; i++) {
+        if (resources[i].def == def) return &resources[i];
+    }
+    return NULL;
+}
+
+// Mesma conta do SPR_loadAllFrames: soma os tiles de todos os quadros
+static u16 countTiles(const SpriteDefinition* def) {
+    u16 total = 0;
+    for (u16 a = 0; a < def->numAnimation; a++) {
+        const Animation* anim = def->animations[a];
+        for (u16 f = 0; f < anim->numFrame; f++)
+            total += anim->frames[f]->tileset->numTile;
+    }
+    return total;
+}
+
+static SpriteResource* acquire(const SpriteDefinition* def) {
+    SpriteResource* res = findResource(def);
+    if (res) {
+        res->refCount++;
+        return res;
+    }
+
+    res = findResource(NULL);
+    if (!res) {
+        debug_log("SpriteCache: sem vaga (MAX_SPRITE_RESOURCES %d)", MAX_SPRITE_RESOURCES);
+        return NULL;
+    }
+
+    s16 base = VRAM_alloc(&region, countTiles(def));
+    if (base < 0) {
+        debug_log("SpriteCache: VRAM cheia para %d tiles", countTiles(def));
+        return NULL;
+    }
+
+    res->def = def;
+    res->baseTile = base;
+    res->frameTiles = SPR_loadAllFrames(def, base, NULL);
+    res->refCount = 1;
+    return res;
+}
+
+static void release(SpriteResource* res) {
+    if (--res->refCount) return;
+
+    VRAM_free(&region, res->baseTile);
+    MEM_free(res->frameTiles);
+    res->frameTiles = NULL;
+    res->def = NULL;
+}
+
+// Troca de quadro: só aponta para os tiles já carregados
+static void onFrameChange(Sprite* sprite) {
+    SpriteResource* res = findResource(sprite->definition);
+    if (res) SPR_setVRAMTileIndex(sprite, res->frameTiles[sprite->animInd][sprite->frameInd]);
+}
+
+Sprite* spriteCache_addSprite(const SpriteDefinition* def, s16 x, s16 y, u16 attr) {
+    SpriteResource* res = acquire(def);
+    if (!res) return NULL;
+
+    // Sem alocação nem upload automático de tiles: quem cuida é o cache
+    Sprite* sprite = SPR_addSpriteEx(def, x, y, attr | res->frameTiles[0][0], SPR_FLAG_AUTO_SPRITE_ALLOC);
+    if (!sprite) {
+        release(res);
+        return NULL;
+    }
+    SPR_setFrameChangeCallback(sprite, onFrameChange);
+    return sprite;
+}
+
+void spriteCache_releaseSprite(Sprite* sprite) {
+    if (!sprite) return;
+    SpriteResource* res = findResource(sprite->definition);
+    SPR_releaseSprite(sprite);
+    if (res) release(res);
+}
+
+void spriteCache_loadPalette(u16 pal, const SpriteDefinition* def) {
+    const u16* data = def->palette->data;
+    if (loadedPalette[pal & 3] == data) return;
+    PAL_setPalette(pal, data, DMA);
+    loadedPalette[pal & 3] = data;
+}
+
+void spriteCache_resetPalettes(void) {
+    for (u16 i = 0; i < 4; i++) loadedPalette[i] = NULL;
+}
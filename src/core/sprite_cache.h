@@ -0,0 +1,36 @@
+#ifndef SPRITE_CACHE_H
+#define SPRITE_CACHE_H
+
+#include <genesis.h>
+
+/**
+ * @brief Reserva a região de VRAM dos sprites compartilhados
+ * @param vramBase Primeiro tile da região
+ * @param vramSize Quantidade de tiles
+ */
+void spriteCache_init(u16 vramBase, u16 vramSize);
+
+/**
+ * @brief Cria um sprite cujos tiles ficam em VRAM uma vez só por definição
+ *
+ * Na primeira instância todos os quadros da definição são carregados
+ * (SPR_loadAllFrames); as próximas só apontam para os mesmos tiles.
+ * @param attr TILE_ATTR(pal, prio, flipV, flipH) - o índice do tile é do cache
+ * @return NULL se faltar VRAM ou vaga de recurso
+ */
+Sprite* spriteCache_addSprite(const SpriteDefinition* def, s16 x, s16 y, u16 attr);
+
+/**
+ * @brief Libera o sprite; os tiles saem da VRAM quando a última instância sai
+ */
+void spriteCache_releaseSprite(Sprite* sprite);
+
+/**
+ * @brief Envia a paleta do sprite só se ela ainda não estiver na linha `pal`
+ */
+void spriteCache_loadPalette(u16 pal, const SpriteDefinition* def);
+
+// Esquece as paletas enviadas (alguém escreveu na CRAM por fora)
+void spriteCache_resetPalettes(void);
+
+#endif // SPRITE_CACHE_H
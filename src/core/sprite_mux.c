@@ -0,0 +1,120 @@
+/**
+ * @file sprite_mux.c
+ * @brief Multiplexação de sprites por faixas de scanline
+ *
+ * A VDP (H40) desenha no máximo SPRITE_LINE_LIMIT sprites por linha e
+ * SPRITE_TOTAL_LIMIT no total; o que passar disso some sem aviso. Aqui a tela
+ * é dividida em faixas de SPRITE_BAND_HEIGHT linhas e cada sprite pedido
+ * "gasta" uma vaga por sprite VDP (32px de largura) em cada faixa que cobre.
+ * Quando não cabe todo mundo, o ponto de partida da distribuição gira a cada
+ * frame e cada objeto aparece em parte dos frames (flicker).
+ */
+
+#include "sprite_mux.h"
+#include "core/game_config.h"
+#include "components/entity.h"
+
+#define BAND_COUNT ((SCREEN_HEIGHT + SPRITE_BAND_HEIGHT - 1) / SPRITE_BAND_HEIGHT)
+
+typedef struct {
+    Entity* entity;
+    u8 firstBand;
+    u8 lastBand;
+    u8 cost;            // sprites VDP por linha
+} MuxCandidate;
+
+static MuxCandidate candidates[MAX_ENTITIES];
+static u16 candidateCount;
+static u16 pinnedCount;                 // Os pinned ficam no começo da lista
+static u8 bandUsage[BAND_COUNT];
+static u16 rotation;
+static SpriteMuxStats stats;
+
+void spriteMux_begin(void) {
+    candidateCount = 0;
+    pinnedCount = 0;
+}
+
+void spriteMux_submit(Entity* e, s16 screenY, bool pinned) {
+    if (candidateCount >= MAX_ENTITIES || !e->anim.sprite) return;
+
+    const SpriteDefinition* def = e->anim.sprite->definition;
+    s16 top = screenY;
+    s16 bottom = screenY + def->h - 1;
+    if (top < 0) top = 0;
+    if (bottom >= SCREEN_HEIGHT) bottom = SCREEN_HEIGHT - 1;
+    if (bottom < top) {
+        // Fora da tela na vertical: esconde e não gasta vaga
+        entity_setVisible(e, FALSE);
+        return;
+    }
+
+    MuxCandidate c = {
+        .entity = e,
+        .firstBand = top / SPRITE_BAND_HEIGHT,
+        .lastBand = bottom / SPRITE_BAND_HEIGHT,
+        .cost = (def->w + 31) >> 5
+    };
+
+    if (pinned) {
+        // Mantém os pinned no início (ordem entre eles não importa)
+        candidates[candidateCount] = candidates[pinnedCount];
+        candidates[pinnedCount++] = c;
+    } else {
+        candidates[candidateCount] = c;
+    }
+    candidateCount++;
+}
+
+// Reserva a vaga se couber em todas as faixas do sprite
+static bool tryPlace(const MuxCandidate* c, u16* total) {
+    if (*total + c->cost > SPRITE_TOTAL_LIMIT) return FALSE;
+    for (u16 b = c->firstBand; b <= c->lastBand; b++) {
+        if (bandUsage[b] + c->cost > SPRITE_LINE_LIMIT) return FALSE;
+    }
+    for (u16 b = c->firstBand; b <= c->lastBand; b++) {
+        bandUsage[b] += c->cost;
+        if (bandUsage[b] > stats.peakBand) stats.peakBand = bandUsage[b];
+    }
+    *total += c->cost;
+    return TRUE;
+}
+
+void spriteMux_resolve(void) {
+    memset(bandUsage, 0, sizeof(bandUsage));
+    u16 total = 0;
+    u16 hidden = 0;
+
+    for (u16 i = 0; i < pinnedCount; i++) {
+        const MuxCandidate* c = &candidates[i];
+        bool shown = tryPlace(c, &total);
+        if (!shown) hidden++;
+        entity_setVisible(c->entity, shown);
+    }
+
+    // Os demais começam de um ponto que gira a cada frame
+    u16 rest = candidateCount - pinnedCount;
+    if (rest) {
+        u16 start = rotation % rest;
+        for (u16 n = 0; n < rest; n++) {
+            u16 i = start + n;
+            if (i >= rest) i -= rest;
+            const MuxCandidate* c = &candidates[pinnedCount + i];
+            bool shown = tryPlace(c, &total);
+            if (!shown) hidden++;
+            entity_setVisible(c->entity, shown);
+        }
+    }
+
+    // Só gira quando houve disputa, senão a ordem fica estável
+    if (hidden) {
+        rotation++;
+        stats.overflowFrames++;
+    }
+    stats.submitted = candidateCount;
+    stats.hidden = hidden;
+}
+
+const SpriteMuxStats* spriteMux_getStats(void) {
+    return &stats;
+}
@@ -0,0 +1,36 @@
+#ifndef SPRITE_MUX_H
+#define SPRITE_MUX_H
+
+#include <genesis.h>
+#include "components/entity_def.h"
+
+// Contadores do multiplexador (para debug/profiling)
+typedef struct {
+    u16 submitted;      // Sprites pedidos no último frame
+    u16 hidden;         // Escondidos por falta de espaço no último frame (flicker)
+    u16 overflowFrames; // Frames com pelo menos um sprite escondido
+    u16 peakBand;       // Maior ocupação de faixa já vista (sprites VDP)
+} SpriteMuxStats;
+
+/**
+ * @brief Começa um frame: zera as faixas e a lista de candidatos
+ */
+void spriteMux_begin(void);
+
+/**
+ * @brief Pede para mostrar o sprite da entidade neste frame
+ * @param screenY Topo do sprite na tela (px)
+ * @param pinned TRUE = nunca pisca (ex: player); entra antes dos outros
+ */
+void spriteMux_submit(Entity* e, s16 screenY, bool pinned);
+
+/**
+ * @brief Decide quem aparece e aplica a visibilidade
+ * Se uma faixa passar do limite da VDP, quem fica de fora muda a cada frame
+ * (rotação), então os objetos piscam em vez de sumirem de vez.
+ */
+void spriteMux_resolve(void);
+
+const SpriteMuxStats* spriteMux_getStats(void);
+
+#endif // SPRITE_MUX_H
@@ -0,0 +1,50 @@
+/**
+ * @file text_bank.c
+ * @brief Decodificador de Huffman dos bancos de texto em ROM
+ *
+ * O diálogo pede um caractere por vez enquanto imprime, então o texto nunca
+ * é descomprimido inteiro: o cursor guarda só o byte corrente da ROM.
+ */
+
+#include "text_bank.h"
+#include "core/logger.h"
+
+static const TextBank* currentBank = NULL;
+
+void textbank_use(const TextBank* bank) {
+    currentBank = bank;
+}
+
+const TextBank* textbank_current(void) {
+    return currentBank;
+}
+
+bool textbank_open(TextCursor* cur, u16 id) {
+    if (!currentBank || id >= currentBank->count) {
+        debug_log("TextBank: texto %d inexistente", id);
+        cur->ptr = NULL;
+        return FALSE;
+    }
+    cur->tree = currentBank->tree;
+    cur->ptr = currentBank->data + currentBank->offsets[id];
+    cur->bitsLeft = 0;
+    return TRUE;
+}
+
+char textbank_next(TextCursor* cur) {
+    if (!cur->ptr) return '\0';
+
+    u16 node = 0;
+    for (;;) {
+        if (!cur->bitsLeft) {
+            cur->byte = *cur->ptr++;
+            cur->bitsLeft = 8;
+        }
+        u16 next = cur->tree[(node << 1) | (cur->byte >> 7)];
+        cur->byte <<= 1;
+        cur->bitsLeft--;
+
+        if (next & TEXTBANK_LEAF) return (char)(next & 0xFF);
+        node = next;
+    }
+}
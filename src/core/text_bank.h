@@ -0,0 +1,67 @@
+#ifndef TEXT_BANK_H
+#define TEXT_BANK_H
+
+#include <genesis.h>
+
+/**
+ * @brief Banco de textos comprimido em ROM, endereçado por ID
+ *
+ * Gerado pelo java_tools/TextBankCompiler a partir de um .txt da cena: todas
+ * as falas passam por um único código de Huffman (o '\0' final também é um
+ * símbolo). Cada texto começa alinhado em byte, em offsets[id], e é lido bit a
+ * bit (MSB primeiro) descendo a árvore a partir do nó 0.
+ *
+ * Bytes abaixo de 32 (fora o '\n') são opcodes das marcações do compilador,
+ * seguidos dos seus argumentos no mesmo fluxo. IDs ocupam dois bytes, alto
+ * primeiro. Argumentos podem valer 0: só o dialogue decide onde o texto acaba.
+ */
+
+// Entrada de tree[] com este bit é folha: o byte baixo é o caractere
+#define TEXTBANK_LEAF   0x8000
+
+#define TEXT_OP_END     0x00
+#define TEXT_OP_SPEED   0x01    // <quadros por caractere>
+#define TEXT_OP_WAIT    0x02    // <quadros>
+#define TEXT_OP_PAL     0x03    // <paleta 0..3>
+#define TEXT_OP_CHOICE  0x04    // <n> <id>... ; fecha as n opções marcadas com TEXT_OP_OPTION
+#define TEXT_OP_JUMP    0x05    // <id>
+#define TEXT_OP_OPTION  0x06    // início de uma opção: a linha atual é a dela
+
+// Entrada de glyphs[] para caractere que nenhum texto do banco imprime
+#define TEXTBANK_GLYPH_UNUSED   0xFF
+
+typedef struct {
+    const u8*  data;        // Fluxo de bits de todos os textos
+    const u16* offsets;     // Byte inicial de cada texto
+    const u16* tree;        // Par (filho 0, filho 1) por nó interno
+    u16 count;
+    const u8*  glyphs;      // (ASCII - 32) -> tile no subconjunto da fonte
+    u16 glyphCount;         // Tiles que o subconjunto ocupa
+} TextBank;
+
+// Leitura em andamento de um texto: decodifica um caractere por chamada
+typedef struct {
+    const u16* tree;
+    const u8*  ptr;
+    u8 byte;                // Bits ainda não lidos, alinhados à esquerda
+    u8 bitsLeft;
+} TextCursor;
+
+/**
+ * @brief Define o banco da cena usado por textbank_open
+ */
+void textbank_use(const TextBank* bank);
+const TextBank* textbank_current(void);   // NULL = nenhum banco
+
+/**
+ * @brief Posiciona o cursor no início do texto `id` do banco atual
+ * @return FALSE se não há banco ou o ID não existe
+ */
+bool textbank_open(TextCursor* cur, u16 id);
+
+/**
+ * @brief Próximo byte do texto (caractere, opcode ou argumento)
+ */
+char textbank_next(TextCursor* cur);
+
+#endif // TEXT_BANK_H
@@ -15,6 +15,9 @@ bool should_update(Vect2D_s16* globalPosition, AABB* aabb, u8 mode){
     
     switch (mode) {
         case UPDATE_ALWAYS:
+        case UPDATE_LOD_2:     // a taxa reduzida é aplicada em update_all_entities
+        case UPDATE_LOD_4:
+        case UPDATE_LOD_8:
             return TRUE;
 
         case UPDATE_VISIBLE_ONLY:
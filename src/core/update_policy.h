@@ -7,8 +7,23 @@ typedef enum {
     UPDATE_ALWAYS = 0,         // Atualiza sempre
     UPDATE_VISIBLE_ONLY,       // Atualiza se visível na tela
     UPDATE_NEAR_CAMERA,        // Atualiza se dentro de margem estendida
-    UPDATE_DISABLED            // Nunca atualiza
+    UPDATE_DISABLED,           // Nunca atualiza
+    // LOD (só lógica): todo frame perto da câmera, longe dela a cada N frames
+    // escalonado pelo índice da entidade. onUpdate recebe os frames passados.
+    UPDATE_LOD_2,
+    UPDATE_LOD_4,
+    UPDATE_LOD_8
 } UpdatePolicy;
 
 bool should_update(Vect2D_s16* globalPosition, AABB* aabb, u8 mode);
+
+// Intervalo em frames de uma política LOD (1 para as demais)
+static inline u16 update_policyInterval(u8 mode) {
+    switch (mode) {
+        case UPDATE_LOD_2: return 2;
+        case UPDATE_LOD_4: return 4;
+        case UPDATE_LOD_8: return 8;
+        default:           return 1;
+    }
+}
 #endif
@@ -1,56 +1,44 @@
 #include "item.h"
 #include "components/entity.h"
 #include "core/logger.h"
-#include "core/camera.h"
-#include "physics/physic_def.h"
+#include "core/spawner.h"
+#include "core/slab_pool.h"
 
-void update_item(Entity* self) ;
+static ItemDef itemDefStorage[MAX_ITEMS];
+static SlabPool itemDefPool;
 
+void item_init() {
+    slab_init(&itemDefPool, itemDefStorage, sizeof(ItemDef), MAX_ITEMS);
+}
 
-Entity* entity_spawnItem(u16 index, const ItemDef* def) {
-    Entity* e = entity_create(UPDATE_DISABLED, UPDATE_VISIBLE_ONLY);
-    if (!e) return NULL;
+static void item_onDestroy(Entity* self) {
+    slab_free(&itemDefPool, self->pData);
+}
 
-    e->active = TRUE;
-    e->tipo = ENTITY_TYPE_ITEM;
-    e->flags = FLAG_INTERACTABLE;
-    e->pData = (void*)def;
+bool item_attach(Entity* e, const ItemDef* def) {
+    ItemDef* itemDef = (ItemDef*)slab_alloc(&itemDefPool);
+    if (!itemDef) return FALSE;
 
-    // Criar hitbox
-    ItemDef* itemDef = (ItemDef*)MEM_alloc(sizeof(ItemDef));
-    itemDef->hitbox.x = def->hitbox.x;
-    itemDef->hitbox.y = def->hitbox.y;
-    itemDef->hitbox.w = def->hitbox.w;
-    itemDef->hitbox.h = def->hitbox.h;
-    
-    debug_log("Item: Spawnado em: %d,%d", itemDef->hitbox.x, itemDef->hitbox.y);
+    // Copia a definição (pode vir da stack do chamador)
+    *itemDef = *def;
 
+    e->pData = itemDef;
     e->onUpdate = NULL;
-
-    // Inicializa animação
-    // --- SPRITE ---
-    e->anim.animSet = NULL;
-    e->anim.sprite = SPR_addSprite(&spr_platform, itemDef->hitbox.x, itemDef->hitbox.y, TILE_ATTR(PAL2, TRUE, FALSE, FALSE));
-    e->anim.visible = true;
-    PAL_setPalette(PAL2, spr_platform.palette->data, DMA);
-
-    // Coloca na posição inicial
-    SPR_setPosition(e->anim.sprite, itemDef->hitbox.x, itemDef->hitbox.y);
-
+    e->onDestroy = item_onDestroy;
     // Define função de interação
     e->onInteract = def->onCollect ? def->onCollect : coletar_item;
 
-    e->pData = itemDef;
-    debug_log("Info: Item criado com sucesso!");
-    return e;
+    debug_log("Item: Spawnado em: %d,%d", itemDef->hitbox.x, itemDef->hitbox.y);
+    return TRUE;
 }
 
 void coletar_item(Entity* self) {
     //ItemDef* def = (ItemDef*)self->pData;
     //setFlag(def->flag_id);
 
-    SPR_setVisibility(self->anim.sprite, HIDDEN);
-    self->active = FALSE;
+    // Não volta quando a câmera passar de novo por aqui
+    spawner_markConsumed(self);
+    entity_destroy(self);
 
     debug_log("Item coletado!");
 }
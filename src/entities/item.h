@@ -5,7 +5,10 @@
 #include "xtypes.h"
 #include "components/entity_def.h"
 
-Entity* entity_spawnItem(u16 index, const ItemDef* def);
+void item_init(); // Reinicia o pool de ItemDef
+// Monta o pData do item numa entidade já criada (ver prefab_item)
+// Sprite, paleta e registro de interação ficam com o prefab
+bool item_attach(Entity* e, const ItemDef* def);
 void coletar_item(Entity* self); // Comportamento padrão de coleta
 
 #endif // ITEM_H
@@ -4,22 +4,30 @@
 #include "components/entity.h"
 #include "components/dialogue.h"
 #include "npc_simple.h"
-#include "core/anim_controller.h"
-#include "physics/physic_def.h"
 #include "core/logger.h"
-
-extern SpriteDefinition npc_sheet;
-extern const AnimStateSet npcAnimSet;
+#include "core/slab_pool.h"
 
 extern UpdateState g_gameState;
 
+static NpcSimpleDef npcDefStorage[MAX_NPCS];
+static SlabPool npcDefPool;
+
+void npc_init()
+{
+    slab_init(&npcDefPool, npcDefStorage, sizeof(NpcSimpleDef), MAX_NPCS);
+}
+
+static void npc_simple_onDestroy(Entity* e)
+{
+    slab_free(&npcDefPool, e->pData);
+}
+
 void npc_simple_onInteract(Entity* e)
 {
     NpcSimpleDef* def = (NpcSimpleDef*)e->pData;
     if (def->textIndex >= def->textCount) return; // já terminou
 
-    const char* text = def->texts[def->textIndex];
-    dialogue_beginText(e->dialogue, 2, 21, 33, 6, text);
+    dialogue_beginTextId(e->dialogue, 2, 21, 33, 6, def->textFirst + def->textIndex);
     g_gameState = GAME_DIALOGUE;
 
     switch (def->textMode) {
@@ -36,29 +44,18 @@ void npc_simple_onInteract(Entity* e)
     }
 }
 
-Entity* npc_createSimple(const NpcSimpleDef* src)
+bool npc_attach(Entity* e, const NpcSimpleDef* src)
 {
-    Entity* e = entity_create(UPDATE_DISABLED, UPDATE_VISIBLE_ONLY);
-    if (!e) return NULL;
-
-    NpcSimpleDef* def = MEM_alloc(sizeof(NpcSimpleDef));
+    NpcSimpleDef* def = slab_alloc(&npcDefPool);
+    if (!def) return FALSE;
     *def = *src; // copia a struct inteira
     def->textIndex = 0; // inicia no começo
 
-    e->active = TRUE;
-    e->tipo = ENTITY_TYPE_NPC;
-    e->flags = FLAG_INTERACTABLE;
     e->pData = (void*)def;
-
     e->onInteract = npc_simple_onInteract;
-
-    e->anim.animSet = &defaultAnimSet;
-    e->anim.sprite = SPR_addSprite(&player_sheet, def->hitbox.x, def->hitbox.y, TILE_ATTR(PAL1, TRUE, FALSE, FALSE));
-    e->anim.visible = TRUE;
-    
-    SPR_setPosition(e->anim.sprite, def->hitbox.x, def->hitbox.y);
+    e->onDestroy = npc_simple_onDestroy;
 
     debug_log("Npc: Spawnado em: %d,%d", def->hitbox.x, def->hitbox.y);
 
-    return e;
+    return TRUE;
 }
@@ -7,8 +7,6 @@
 #include "components/dialogue.h"
 #include "components/entity.h"
 
-#define MAX_NPC_TEXTS 4
-
 /*
 Modo	    Comportamento
 LOOP	    Repete ciclicamente as falas
@@ -23,13 +21,16 @@ typedef enum {
 
 typedef struct {
     Box hitbox;                      // área de interação
-    const char* texts[MAX_NPC_TEXTS]; // lista de falas
-    u16 textCount;                    // número total de falas
+    u16 textFirst;                    // ID da primeira fala no banco de textos da cena
+    u16 textCount;                    // número de falas (IDs seguidos a partir de textFirst)
     u16 textIndex;                    // índice atual
     NpcTextMode textMode;
 } NpcSimpleDef;
 
-Entity* npc_createSimple(const NpcSimpleDef* def);
+void npc_init(); // Reinicia o pool de NpcSimpleDef
+// Monta o pData do NPC numa entidade já criada (ver prefab_npc)
+// Sprite, animação e registro de interação ficam com o prefab
+bool npc_attach(Entity* e, const NpcSimpleDef* def);
 void npc_simple_onInteract(Entity* e);
 
 #endif // NPC_SIMPLE_H
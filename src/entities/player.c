@@ -10,9 +10,11 @@
 #include "core/logger.h"
 #include "core/camera.h"
 #include "core/game_config.h"
+#include "core/event_bus.h"
+#include "text/fase1_text.h"
 
 static void player_handleInput(u16 joy, u16 changed, u16 state);
-static void update_player(Entity* self);
+static void update_player(Entity* self, u16 frames);
 void player_onEvent(Entity* self, EntityEventType type);
 static void debugDrawCollisionBoxes();
 
@@ -45,7 +47,7 @@ Entity* player_init(s16 x, s16 y){
     body->vState = VSTATE_AIRBORNE;
     body->aState = ASTATE_NONE;
 
-    body->support = NULL;
+    body->support = HANDLE_NULL;
     e->tipo = ENTITY_TYPE_PLAYER;
     e->flags = FLAG_SOLID;  
 
@@ -63,7 +65,7 @@ Entity* player_init(s16 x, s16 y){
     e->anim.visible = TRUE;
     animcontroller_init(&e->anim, e->anim.sprite, &defaultAnimSet);
     
-    body->owner = e;
+    body->owner = entity_getHandle(e);
     pEntity = e;
     PAL_setPalette(PAL1, player_sheet.palette->data, DMA);
 
@@ -101,19 +103,14 @@ static void player_handleInput(u16 joy, u16 changed, u16 state) {
         else if (changed & (BUTTON_C)) {
 			if (state & (BUTTON_C)) {
                 const  u16 X = 2, Y = 21, W = 33, H = 6;    
-                char* txt = ("Este e' um exemplo de texto longo que "
-                            "ultrapassa a altura da caixa, entao "
-                            "ele vai rolar automaticamente.\n"
-                            "Pode colocar '\\n' onde quiser.\n"
-                            "E continua rolando ate' o fim.");
-                dialogue_beginText(pEntity->dialogue, X, Y, W, H, txt);   
+                dialogue_beginTextId(pEntity->dialogue, X, Y, W, H, TXT_PLAYER_DEMO);   
                 g_gameState = GAME_DIALOGUE;             
             }
         }
     }
 }   
 
-static void update_player(Entity* self) {
+static void update_player(Entity* self, u16 frames) {
     RigidBody* body = self->body;
 
     // --- Aceleração horizontal
@@ -145,6 +142,7 @@ static void update_player(Entity* self) {
     if (currentCoyoteTime > 0 && currentJumpBufferTime > 0 && body->vState == VSTATE_GROUNDED) {
         //body->vState = VSTATE_JUMPING;
         physics_applyImpulse(body, 0, -body->physics->jumpSpeed);
+        eventBus_push(self, ENTITY_EVENT_JUMP);
         currentCoyoteTime = 0;
         currentJumpBufferTime = 0;
     }
@@ -17,10 +17,10 @@
 #include "physics/physic_def.h"
 #include "tiled/tiled_map.h"
 #include "core/logger.h"
+#include "core/event_bus.h"
 #include "tiled/fase1_slopes.h"
 #include "components/path_follower.h"
 #include "core/game_config.h"
-#include "components/blocking_zone.h"
 
 #define SUPPORT_EPSILON 4  // tolerância de até 4px entre base e topo
 #define FIX32_TO_TILE(x)  ((x) >> 10)  // (26.6 → 16.4 → /16)
@@ -65,8 +65,9 @@ void physics_updateAll() {
     bool update;
     for (u16 i = 0; i < MAX_BODIES; i++) {
         RigidBody* body = getRigidBody(i);
-        Entity* e = body->owner;
         if(!body->active) continue;        
+        Entity* e = entity_resolve(body->owner);
+        if(!e) continue;
         
         // Atualiza gravidade, posição e delta!
         rigidbody_update(body);
@@ -84,19 +85,19 @@ void physics_updateAll() {
             //physics_checkStairsCollision(body);
             //physics_checkCustomTiles(body);
             physics_checkPlatformCollision(body);
-            physics_checkBlockingZones(body);
             // Verifica se o corpo está apoiado em algum outro corpo
-            if(body->support && body->support->active ){
+            RigidBody* support = rigidbody_resolve(body->support);
+            if(support && support->active ){
                 // Verifica se os layers são compatíveis usando a máscara
-                if(body->mask & (1 << body->support->layer)) {
-                    s32 supportY = (body->support->globalPosition.y);            
+                if(body->mask & (1 << support->layer)) {
+                    s32 supportY = (support->globalPosition.y);            
                     s16 deltaY = supportY - (body->globalPosition.y + body->aabb.max.y);
 
                     if(deltaY >= -8 && deltaY <= 4 && body->velocity.fixY >= 0){
                         s16 heigth = body->aabb.max.y - body->aabb.min.y;
                         
                         body->globalPosition.y = supportY - heigth;                        
-                        body->globalPosition.x += F16_toInt(body->support->delta.x);
+                        body->globalPosition.x += F16_toInt(support->delta.x);
                         body->velocity.fixY = 0;
                         body->vState = VSTATE_GROUNDED;
                     } 
@@ -104,13 +105,10 @@ void physics_updateAll() {
             }
         }
 
-        if(body->owner){
-            Entity* e = body->owner;
-            if(body->vState == VSTATE_GROUNDED && !e->wasOnGround){ 
-                e->onEvent(e, ENTITY_EVENT_LAND);
-            }
-            e->wasOnGround = (body->vState == VSTATE_GROUNDED);
+        if(body->vState == VSTATE_GROUNDED && !e->wasOnGround){ 
+            eventBus_push(e, ENTITY_EVENT_LAND);
         }
+        e->wasOnGround = (body->vState == VSTATE_GROUNDED);
         // atualiza posição visual com base na câmera apos checar todas as colisions
         body->position.x = body->globalPosition.x - camera_getPosition().x;
         body->position.y = body->globalPosition.y - camera_getPosition().y;
@@ -499,7 +497,7 @@ void physics_checkCustomTiles(RigidBody* body) {
  * 4. Atualiza o suporte do corpo se encontrado
  */
 void physics_checkPlatformCollision(RigidBody* body) {
-    body->support = findSupportBelow(body);
+    body->support = rigidbody_getHandle(findSupportBelow(body));
 }
 
 /**
@@ -532,8 +530,9 @@ RigidBody* findSupportBelow(RigidBody* self) {
  * @return true se other pode suportar self
  */
 bool aabb_checkVerticalSupport(const RigidBody* self, const RigidBody* other) {
-    Entity* o = other->owner;
     if (!self || !other) return FALSE;
+    Entity* o = entity_resolve(other->owner);
+    if (!o) return FALSE;
     if (!self->active || !other->active) return FALSE;
     if (!self->collidable || !other->collidable) return FALSE;
 
@@ -5,6 +5,7 @@
 #include "gfx.h"
 #include "tiled/fase1_col.h"
 #include "tiled/fase1_obj.h"
+#include "text/fase1_text.h"
 #include "components/path_def.h"
 #include "physics/physic_def.h"
 #include "components/object_factory.h"
@@ -15,6 +16,12 @@
 #include "components/dialogue.h"
 #include "types.h"
 #include "entities/npc_simple.h"
+#include "core/spawner.h"
+#include "core/prefab.h"
+#include "core/frame_budget.h"
+#include "core/event_bus.h"
+#include "core/sprite_cache.h"
+#include "components/interact.h"
 
 static Map* fase1_bga;
 static Entity* entityPlayer;
@@ -24,8 +31,26 @@ static u16 VDPTilesFilled = TILE_USER_INDEX;
 DialogueState activeDialogue;
 UpdateState g_gameState;
 
+// Registro de prefabs da fase por SpawnKind (NULL = tipo ainda sem entidade)
+static const PrefabDef* const fase1_prefabs[SPAWN_KIND_COUNT] = {
+    [SPAWN_KIND_ITEM]     = &prefab_item,
+    [SPAWN_KIND_PLATFORM] = &prefab_platformTimed,
+    [SPAWN_KIND_NPC]      = &prefab_npc,
+    [SPAWN_KIND_TRIGGER]  = &prefab_trigger,
+};
+
+// Destaque das escolhas do diálogo: toda cor não transparente vira amarelo, então
+// o rótulo fica legível seja qual for o índice que a fonte usa nos glifos
+static const u16 choicePalette[16] = {
+    0x000, 0x0EE, 0x0EE, 0x0EE, 0x0EE, 0x0EE, 0x0EE, 0x0EE,
+    0x0EE, 0x0EE, 0x0EE, 0x0EE, 0x0EE, 0x0EE, 0x0EE, 0x0EE,
+};
+
 void GameInit(){
 
+    // Solta zonas (e sprites delas) de uma execução anterior antes do SPR_init
+    blocking_clearAll();
+
     VDP_init();
     SPR_init();
 
@@ -33,6 +58,9 @@ void GameInit(){
     PAL_setPalette(PAL0, bga_pal.data, DMA);  
     fase1_bga = MAP_create(&bga_map, BG_A, TILE_ATTR_FULL(PAL0, FALSE, FALSE, FALSE, VDPTilesFilled)); 
     VDPTilesFilled += bga.numTile;
+    // região de VRAM dos sprites compartilhados (plataformas, itens, npcs)
+    spriteCache_init(VDPTilesFilled, SPRITE_CACHE_VRAM_TILES);
+    VDPTilesFilled += SPRITE_CACHE_VRAM_TILES;
     // carrega array de colisão exportado do tiled
     tiledMap_loadFromArray(&fase1_col);
     
@@ -42,8 +70,18 @@ void GameInit(){
     physics_init();
     // inicia sistema de rigidbody
     rigidbody_init();
+    // inicia pools de dados (pData) das entidades
+    pathFollower_init();
+    trigger_init();
+    item_init();
+    npc_init();
+    interact_init();
+    frameBudget_init();
+    eventBus_init();
     // inicia player na pos x e y
     entityPlayer = player_init(600, 520);
+    // player_init escreve a PAL1 direto na CRAM: o cache não pode confiar no que lembra
+    spriteCache_resetPalettes();
 
     Vect2D_u16 deadzone = { 64, 48 };
     // inicia camera
@@ -51,46 +89,23 @@ void GameInit(){
     // linka bga com camera
     camera_bindMaps(fase1_bga, NULL);
     
-    blocking_clearAll();
-    
-    spawn_entity_platform(0, DIST_EUCLIDEAN);
-
-    ItemDef item_def = {
-        .name = "Item de teste",
-        .id = 0,
-        .sprite = &spr_platform,
-        .flag_id = 0,
-        .hitbox = {
-            .x = 750,
-            .y = 470,
-            .w = 80,
-            .h = 16
-        },
-        .onCollect = NULL
-    };
-
-    entity_spawnItem(0, &item_def);
-
-    create_trigger_with_blocking_zone(
-        newVector2D_u16(350, 545), newVector2D_u16(750, 480), 
-        &spr_totem, &spr_platformV, 
-        TRIGGER_ZONE_TOGGLE, TRIGGER_TYPE_REPEAT,
-        NULL, trigger_applyZoneAction_wrapper, NULL);
-
-    trigger_setTarget(entityPlayer);
+    // Objetos do Tiled são criados/destruídos conforme a câmera anda
+    spawner_init(fase1_spawns, FASE1_SPAWN_COUNT, fase1_prefabs, SPAWN_KIND_COUNT);
 
     /* --------------------------------------- */
     dialogue_init(&activeDialogue, PAL1, VDPTilesFilled);
-    dialogue_setFont(&activeDialogue, &custom_font, PAL1);    
-    
-    NpcSimpleDef tia = {
-        .hitbox = { 450, 560, 32, 64 },
-        .texts = { "Oi, querido!", "Aproveite sua jornada.", "Passe em casa depois." },
-        .textCount = 3,
-        .textMode = NPC_TEXTMODE_STOP_LAST
-    };
-
-    npc_createSimple(&tia);
+    VDPTilesFilled += DIALOGUE_BOX_TILES;
+    textbank_use(&fase1_text);
+#if DIALOGUE_FONT_MODE == DIALOGUE_FONT_VWF
+    dialogue_setFontVwf(&activeDialogue, &custom_font, PAL1, VDPTilesFilled);
+    VDPTilesFilled += DIALOGUE_VWF_VRAM_TILES;
+#else
+    // Mesmo banco do textbank_use: o diálogo recusa textos de outro banco
+    dialogue_setFontSubset(&activeDialogue, &custom_font, PAL1, VDPTilesFilled, &fase1_text);
+    VDPTilesFilled += FASE1_TEXT_GLYPHS;
+#endif
+    dialogue_useWindow(&activeDialogue, DIALOGUE_WINDOW_ROW);
+    dialogue_setChoicePal(&activeDialogue, DIALOGUE_CHOICE_PAL, choicePalette);
 
     debug_log("Info: GameInit finalizado com sucesso!");
 }
@@ -98,11 +113,26 @@ void GameInit(){
 void GameUpdate(void){
     if (g_gameState == GAME_DIALOGUE)
     {
-        if (dialogue_updateText(&activeDialogue))
+        static u16 prevJoy;
+        const u16 joy = JOY_readJoypad(JOY_1);
+        const u16 pressed = joy & ~prevJoy;
+        prevJoy = joy;
+
+        // Abrir/fechar a caixa é um passo por frame: o loop nunca trava
+        if (!dialogue_boxUpdate(&activeDialogue))
+        {
+            // caixa animando: o texto espera
+        }
+        else if (!activeDialogue.active)
         {
-            if (JOY_readJoypad(0) & BUTTON_START)
+            // terminou de fechar: volta ao jogo
+            g_gameState = GAME_RUNNING;
+        }
+        else if (dialogue_updateText(&activeDialogue))
+        {
+            if (joy & BUTTON_START)
             {
-                // Fecha a caixa e volta ao jogo
+                // Fecha a caixa; o retorno ao jogo vem quando a animação acabar
                 dialogue_boxCloseCenter(&activeDialogue, 
                                         activeDialogue.bgX, 
                                         activeDialogue.bgY, 
@@ -110,16 +140,24 @@ void GameUpdate(void){
                                         activeDialogue.bgH, 
                                         activeDialogue.boxBaseTile, 
                                         activeDialogue.fontPalette, 2);
-                g_gameState = GAME_RUNNING;
             }
         }
+        else if (activeDialogue.choiceCount)
+        {
+            // {choice ...}: cima/baixo troca a opção, A/C/START confirma
+            if (pressed & BUTTON_UP)   dialogue_choiceMove(&activeDialogue, -1);
+            if (pressed & BUTTON_DOWN) dialogue_choiceMove(&activeDialogue, 1);
+            if (pressed & (BUTTON_A | BUTTON_C | BUTTON_START)) dialogue_choose(&activeDialogue);
+        }
 
         // Mesmo em diálogo, ainda pode:
         // - atualizar animações de cenário
         // - atualizar câmeras
         camera_update();
         entity_drawAll();
-        SPR_update();
+        blocking_drawAll();
+        frameBudget_run();
+        animcontroller_updateSprites();
         SYS_doVBlankProcess();
         return;
     }
@@ -136,17 +174,41 @@ void GameUpdate(void){
      */
     physics_updateAll();    
 
+    /* Responsável por: Enter/exit dos triggers (grade de ocupação x corpos já movidos)
+     */
+    trigger_updateAll();
+
+    /* Responsável por: Entregar os eventos (LAND, JUMP, trigger enter/exit...) gerados acima
+     * Os callbacks rodam aqui, juntos, e não no meio dos loops de lógica/física
+     */
+    eventBus_dispatch();
+
     /* Responsável por: Atualizar posição da camera
     */
     camera_update();
 
+    /* Responsável por: Criar/destruir os objetos da fase que entram/saem da janela da câmera
+    */
+    spawner_update();
+
     /* Responsável por: Atualizar visual (sprite) de cada entidade
      * Atualiza a animação (frame atual), sincroniza a posição do Sprite com RigidBody.position
      * entity.h chama draw da entidade
      */
     entity_drawAll();
 
-    SPR_update();
+    /* Responsável por: Sprites das barreiras (ficam com a fase, não com o trigger)
+     */
+    blocking_drawAll();
+
+    /* Responsável por: Usar as scanlines que sobraram com tarefas adiáveis
+     * Para antes de FRAME_BUDGET_END_LINE; o resto continua no próximo frame
+     */
+    frameBudget_run();
+
+    /* Responsável por: SPR_update(), só se algum sprite mudou (posição, flip, visibilidade, animação)
+     */
+    animcontroller_updateSprites();
     SYS_doVBlankProcess();
 }
 
@@ -162,5 +224,8 @@ void GameHandlerInput(u16 joy, u16 changed, u16 state){
 }
 
 void GameUnloadState(){
-
+    // O próximo estado escreve a CRAM por conta própria
+    spriteCache_resetPalettes();
+    // Sprites das zonas e backup dos tiles pertencem a esta fase
+    blocking_clearAll();
 }
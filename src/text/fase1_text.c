@@ -0,0 +1,100 @@
+#include "fase1_text.h"
+
+// 6 textos: 342 bytes de texto -> 203 bytes de dados + 184 de árvore
+
+static const u8 fase1_text_data[] = {
+    0x68, 0xA0, 0xA9, 0x7B, 0x7C, 0x54, 0x7E, 0x09, 0x6E, 0x6D, 0x06, 0x6F,
+    0x8A, 0x6D, 0xCA, 0x3E, 0x80, 0x46, 0xF6, 0x08, 0x19, 0xBE, 0x2C, 0xB0,
+    0x45, 0xC1, 0xD8, 0x4A, 0x55, 0x60, 0x76, 0xE7, 0x32, 0x38, 0x73, 0x80,
+    0xB9, 0x69, 0x61, 0x8E, 0xA7, 0xFA, 0x7B, 0x6A, 0x36, 0x61, 0x55, 0x3D,
+    0x68, 0xE0, 0x16, 0xBD, 0xEE, 0x9C, 0xE8, 0x05, 0xE5, 0x1F, 0xD6, 0xE5,
+    0x3D, 0xA3, 0x80, 0xB9, 0xE9, 0x6B, 0x17, 0xD0, 0xDC, 0x27, 0x2F, 0x45,
+    0x57, 0xA7, 0x4F, 0x63, 0x6D, 0x2A, 0x3D, 0x7B, 0x4D, 0xCD, 0x6C, 0x0C,
+    0x69, 0x77, 0xD6, 0xF1, 0x76, 0xB5, 0xA8, 0xA0, 0xFC, 0x25, 0xAD, 0x6A,
+    0x03, 0x8B, 0xEB, 0x47, 0x69, 0xDB, 0xF2, 0x35, 0xF3, 0x84, 0xD8, 0x66,
+    0x70, 0xC7, 0xBB, 0xEF, 0xF4, 0xE0, 0xA6, 0xDD, 0x3A, 0xFF, 0x3A, 0xD6,
+    0x64, 0x7F, 0x4F, 0xF5, 0xFF, 0xE4, 0x66, 0x54, 0x76, 0x4B, 0xDB, 0xE9,
+    0xB6, 0x7C, 0x95, 0xAB, 0xDE, 0x51, 0x44, 0xCF, 0xEC, 0x94, 0x7A, 0x80,
+    0x54, 0xBE, 0x85, 0x4E, 0xAF, 0xD6, 0x4E, 0x67, 0x43, 0x0A, 0x90, 0xB1,
+    0x88, 0xA2, 0xDF, 0xF1, 0xCB, 0xF4, 0x02, 0x77, 0x57, 0xFD, 0xAB, 0x05,
+    0xE3, 0xFA, 0x03, 0x19, 0x80, 0x45, 0x02, 0x6A, 0xA8, 0x53, 0x2A, 0xFE,
+    0x97, 0xB7, 0x4F, 0x71, 0x6A, 0xCB, 0xB0, 0x19, 0x5F, 0xD2, 0xBB, 0x50,
+    0xB1, 0x8A, 0xAF, 0xC8, 0xBF, 0xC1, 0x4C, 0x83, 0x68, 0xED, 0x1C,
+};
+
+static const u16 fase1_text_offsets[] = {
+    0,   // TXT_NPC_TIA_0
+    36,   // TXT_NPC_TIA_1
+    50,   // TXT_NPC_TIA_2
+    63,   // TXT_TIA_DICA
+    100,   // TXT_TIA_TCHAU
+    110,   // TXT_PLAYER_DEMO
+};
+
+static const u16 fase1_text_tree[] = {
+    0x0001, 0x0002,
+    0x0003, 0x0004,
+    0x0005, 0x0006,
+    0x0007, 0x0008,
+    0x8061, 0x0009,
+    0x8020, 0x000A,
+    0x000B, 0x000C,
+    0x000D, 0x000E,
+    0x8072, 0x000F,
+    0x0010, 0x0011,
+    0x0012, 0x0013,
+    0x806F, 0x0014,
+    0x8065, 0x0015,
+    0x8063, 0x0016,
+    0x0017, 0x0018,
+    0x0019, 0x8000,
+    0x806C, 0x001A,
+    0x806D, 0x8064,
+    0x8069, 0x806E,
+    0x001B, 0x001C,
+    0x802E, 0x8075,
+    0x8073, 0x8074,
+    0x8027, 0x001D,
+    0x001E, 0x001F,
+    0x0020, 0x0021,
+    0x0022, 0x0023,
+    0x0024, 0x0025,
+    0x800A, 0x8070,
+    0x0026, 0x0027,
+    0x8001, 0x8004,
+    0x8006, 0x8021,
+    0x802C, 0x8050,
+    0x8051, 0x8066,
+    0x8067, 0x8068,
+    0x8076, 0x0028,
+    0x0029, 0x002A,
+    0x002B, 0x002C,
+    0x002D, 0x8002,
+    0x8041, 0x8045,
+    0x8071, 0x8078,
+    0x8003, 0x8005,
+    0x8008, 0x8014,
+    0x801E, 0x803F,
+    0x804F, 0x8054,
+    0x805C, 0x8062,
+    0x806A, 0x807A,
+};
+
+// Glifo (ASCII - 32) -> tile do subconjunto; 0xFF = não usado na cena
+static const u8 fase1_text_glyphs[96] = {
+    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0x04, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
+    0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08,
+    0x09, 0x0A, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0xFF, 0x17, 0x18, 0x19, 0x1A,
+    0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0xFF, 0x22, 0xFF, 0x23, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+const TextBank fase1_text = {
+    fase1_text_data,
+    fase1_text_offsets,
+    fase1_text_tree,
+    6,
+    fase1_text_glyphs,
+    36
+};
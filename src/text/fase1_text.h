@@ -0,0 +1,20 @@
+#ifndef FASE1_TEXT_H
+#define FASE1_TEXT_H
+
+#include "core/text_bank.h"
+
+// Gerado por java_tools/TextBankCompiler - não editar
+
+#define TXT_NPC_TIA_0                0
+#define TXT_NPC_TIA_1                1
+#define TXT_NPC_TIA_2                2
+#define TXT_TIA_DICA                 3
+#define TXT_TIA_TCHAU                4
+#define TXT_PLAYER_DEMO              5
+
+#define FASE1_TEXT_COUNT 6
+#define FASE1_TEXT_GLYPHS 36   // Tiles de fonte do setFontSubset
+
+extern const TextBank fase1_text;
+
+#endif // FASE1_TEXT_H
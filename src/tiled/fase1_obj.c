@@ -16,13 +16,28 @@ const Vect2D_u16 path_51[] = {
     { 321, 585 },
 };
 
+const PathSegment path_34_v1[] = {
+    { .stepX = 64, .stepY = 0, .steps = 125 },
+    { .stepX = -64, .stepY = 0, .steps = 125 },
+};
+
+const PathSegment path_43_v1[] = {
+    { .stepX = 64, .stepY = 0, .steps = 112 },
+    { .stepX = 0, .stepY = -64, .steps = 64 },
+    { .stepX = -56, .stepY = 32, .steps = 129 },
+};
+
+const PathSegment path_51_v1[] = {
+    { .stepX = 64, .stepY = 0, .steps = 235 },
+    { .stepX = -64, .stepY = 0, .steps = 235 },
+};
+
 const player_start_pos_t player_start_poss[] = {
     {  },
 };
 
 const Item_t Items[] = {
     { .id = 4, .nome = "Espada", .property = 4, .type = 0 },
-    { .id = 4, .nome = "Espada2", .property = 4, .type = 0 },
 };
 
 const enemy_t enemys[] = {
@@ -41,11 +56,23 @@ const spawn_sprite_t spawn_sprites[] = {
 };
 
 const platform_t platforms[] = {
-    { .agentDef = { .position = { 416, 551 }, .path = path_43, .path_len = 3, .delayInicial = 60, .path_mode = PATHMODE_LOOP, .velocidade = FIX16(1), .sprite = "spr_platform", .w = 80, .h = 16 } },
-    { .agentDef = { .position = { 235, 310 }, .path = path_34, .path_len = 2, .delayInicial = 60, .path_mode = PATHMODE_PINGPONG, .velocidade = FIX16(1), .sprite = "spr_platform", .w = 80, .h = 16 } },
+    { .agentDef = { .position = { 235, 310 }, .path = path_34, .path_len = 2, .delayInicial = 60, .path_mode = PATHMODE_PINGPONG, .velocidade = FIX16(1), .segments = path_34_v1, .curve = NULL, .sprite = "spr_platform", .w = 80, .h = 16 } },
+    { .agentDef = { .position = { 416, 551 }, .path = path_43, .path_len = 3, .delayInicial = 60, .path_mode = PATHMODE_LOOP, .velocidade = FIX16(1), .segments = path_43_v1, .curve = NULL, .sprite = "spr_platform", .w = 80, .h = 16 } },
 };
 
 const npc_t npcs[] = {
-    { .agentDef = { .position = { 168, 560 }, .path = path_51, .path_len = 2, .delayInicial = 60, .path_mode = PATHMODE_PINGPONG, .velocidade = FIX16(1), .sprite = "spr_platform", .w = 80, .h = 16 } },
+    { .agentDef = { .position = { 168, 560 }, .path = path_51, .path_len = 2, .delayInicial = 60, .path_mode = PATHMODE_PINGPONG, .velocidade = FIX16(1), .segments = path_51_v1, .curve = NULL, .sprite = "player_sheet", .w = 32, .h = 64 }, .textFirst = 0, .textCount = 3, .textMode = 1 },
+};
+
+const trigger_t triggers[] = {
+    { .type = 1, .zoneAction = 3, .zoneX = 750, .zoneY = 480 },
+};
+
+const SpawnPoint fase1_spawns[FASE1_SPAWN_COUNT] = {
+    { .x = 168, .y = 560, .kind = SPAWN_KIND_NPC, .index = 0 },
+    { .x = 235, .y = 310, .kind = SPAWN_KIND_PLATFORM, .index = 0 },
+    { .x = 350, .y = 545, .kind = SPAWN_KIND_TRIGGER, .index = 0 },
+    { .x = 416, .y = 551, .kind = SPAWN_KIND_PLATFORM, .index = 1 },
+    { .x = 750, .y = 470, .kind = SPAWN_KIND_ITEM, .index = 0 },
 };
 
@@ -3,10 +3,14 @@
 
 #include <genesis.h>
 #include "components/path_def.h"
+#include "core/spawner_def.h"
 
 extern const Vect2D_u16 path_34[];
 extern const Vect2D_u16 path_43[];
 extern const Vect2D_u16 path_51[];
+extern const PathSegment path_34_v1[];
+extern const PathSegment path_43_v1[];
+extern const PathSegment path_51_v1[];
 typedef struct {
 } player_start_pos_t;
 
@@ -43,8 +47,34 @@ typedef struct {
 extern const platform_t platforms[];
 typedef struct {
     PathAgentDef agentDef;
+    u8 textFirst;
+    u8 textCount;
+    u8 textMode;
 } npc_t;
 
 extern const npc_t npcs[];
+typedef struct {
+    u8 type;
+    u8 zoneAction;
+    s16 zoneX;
+    s16 zoneY;
+} trigger_t;
+
+extern const trigger_t triggers[];
+
+typedef enum {
+    SPAWN_KIND_PLAYER_START_POS,
+    SPAWN_KIND_ITEM,
+    SPAWN_KIND_ENEMY,
+    SPAWN_KIND_PORTAL,
+    SPAWN_KIND_SPAWN_SPRITE,
+    SPAWN_KIND_PLATFORM,
+    SPAWN_KIND_NPC,
+    SPAWN_KIND_TRIGGER,
+    SPAWN_KIND_COUNT
+} SpawnKind;
+
+#define FASE1_SPAWN_COUNT 5
+extern const SpawnPoint fase1_spawns[FASE1_SPAWN_COUNT];
 
 #endif // OBJETOS_H
@@ -80,6 +80,13 @@ u16 tiledMap_getTile(s16 tileX, s16 tileY) {
     return currentMap[tileY][tileX];
 }
 
+// O mapa fica em RAM: quem altera (ex.: blocking zones) guarda o valor antigo
+void tiledMap_setTile(s16 tileX, s16 tileY, u8 value) {
+    if (tileX >= mapSize.x || tileY >= mapSize.y || tileX < 0 || tileY < 0) return;
+
+    currentMap[tileY][tileX] = value;
+}
+
 Vect2D_u16 tiledMap_posToTile(Vect2D_s16 position) {
     return newVector2D_u16(position.x >> 4, position.y >> 4);
 }
@@ -19,6 +19,7 @@ u16 tiledMap_getHeight();
 u16 tiledMap_getWidth();
 
 u16 tiledMap_getTile(s16 tileX, s16 tileY) ;
+void tiledMap_setTile(s16 tileX, s16 tileY, u8 value);
 Vect2D_u16 tiledMap_posToTile(Vect2D_s16 position);
 AABB tiledMap_getTileBounds(u16 tileX, u16 tileY);
 bool tiledMap_isSolid(u16 tileX, u16 tileY);